@@ -1,22 +1,22 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/tools/detail/print_helper.hpp>
-#include "hash_table.hpp"
+#include <hash_table/hash_table.hpp>
 
 namespace boost::test_tools::tt_detail
 {
   template< class Key, class Value, class Hash, class Equal >
-  struct print_log_value< abramov::Iterator< Key, Value, Hash, Equal  > >
+  struct print_log_value< abramov::HashIterator< Key, Value, Hash, Equal > >
   {
-    void operator()(std::ostream &os, const abramov::Iterator< Key, Value, Hash, Equal > &iter)
+    void operator()(std::ostream &os, const abramov::HashIterator< Key, Value, Hash, Equal > &)
     {
       os << "iter";
     }
   };
 
   template< class Key, class Value, class Hash, class Equal >
-  struct print_log_value< abramov::ConstIterator< Key, Value, Hash, Equal > >
+  struct print_log_value< abramov::ConstHashIterator< Key, Value, Hash, Equal > >
   {
-    void operator()(std::ostream &os, const abramov::ConstIterator< Key, Value, Hash, Equal > &iter)
+    void operator()(std::ostream &os, const abramov::ConstHashIterator< Key, Value, Hash, Equal > &)
     {
       os << "cIter";
     }
@@ -117,3 +117,70 @@ BOOST_AUTO_TEST_CASE(empty)
   table.insert(8, "b");
   BOOST_TEST(!table.empty());
 }
+
+BOOST_AUTO_TEST_CASE(insert_existing_key)
+{
+  abramov::HashTable< int, std::string > table;
+  table.insert(10, "a");
+  table.insert(10, "b");
+  BOOST_TEST(table.size() == 1);
+  BOOST_TEST(table.find(10)->second == "b");
+}
+
+BOOST_AUTO_TEST_CASE(growth)
+{
+  abramov::HashTable< int, int > table;
+  for (int i = 0; i < 10000; ++i)
+  {
+    table.insert(i, i * 2);
+  }
+  BOOST_TEST(table.size() == 10000);
+  BOOST_TEST(table.loadFactor() <= 0.7);
+  size_t count = 0;
+  for (auto it = table.cbegin(); it != table.cend(); ++it)
+  {
+    BOOST_TEST(it->second == it->first * 2);
+    ++count;
+  }
+  BOOST_TEST(count == 10000);
+}
+
+BOOST_AUTO_TEST_CASE(erase_reinsert)
+{
+  abramov::HashTable< int, std::string > table;
+  for (int round = 0; round < 100; ++round)
+  {
+    for (int i = 0; i < 10; ++i)
+    {
+      table.insert(round * 10 + i, "a");
+    }
+    for (int i = 0; i < 10; i += 2)
+    {
+      BOOST_TEST(table.erase(round * 10 + i) == 1);
+    }
+    BOOST_TEST(table.erase(round * 10) == 0);
+  }
+  BOOST_TEST(table.size() == 500);
+  for (int i = 0; i < 1000; ++i)
+  {
+    bool found = table.find(i) != table.end();
+    BOOST_TEST(found == (i % 2 == 1));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(copy)
+{
+  abramov::HashTable< std::string, int > table;
+  for (int i = 0; i < 100; ++i)
+  {
+    table.insert(std::to_string(i), i);
+  }
+  table.erase("7");
+  abramov::HashTable< std::string, int > copy(table);
+  table["8"] = 80;
+  BOOST_TEST(copy.size() == 99);
+  BOOST_TEST(copy.at("8") == 8);
+  BOOST_TEST(table.at("8") == 80);
+  BOOST_TEST((copy.cfind("7") == copy.cend()));
+  BOOST_TEST(copy.at("99") == 99);
+}
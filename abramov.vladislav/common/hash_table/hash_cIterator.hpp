@@ -1,8 +1,8 @@
 #ifndef CITERATOR_HPP
 #define CITERATOR_HPP
 #include <iterator>
+#include <memory>
 #include "decls.hpp"
-#include "hash_node.hpp"
 
 namespace abramov
 {
@@ -16,7 +16,7 @@ namespace abramov
     using cIter = const ConstHashIterator< Key, Value, Hash, Equal >;
 
     ConstHashIterator();
-    ConstHashIterator(const HashTable< Key, Value, Hash, Equal > *t, size_t i, const HashNode< Key, Value > *n);
+    ConstHashIterator(const HashTable< Key, Value, Hash, Equal > *t, size_t i);
     ConstHashIterator(const ConstHashIterator< Key, Value, Hash, Equal > &c_iter) = default;
     ~ConstHashIterator() = default;
     ConstHashIterator< Key, Value, Hash, Equal > &operator=(const ConstHashIterator< Key, Value, Hash, Equal > &c_iter) = default;
@@ -29,7 +29,6 @@ namespace abramov
   private:
     const HashTable< Key, Value, Hash, Equal > *table_;
     size_t ind_;
-    const HashNode< Key, Value > *node_;
 
     void goNext() noexcept;
   };
@@ -38,27 +37,21 @@ namespace abramov
 template< class Key, class Value, class Hash, class Equal >
 abramov::ConstHashIterator< Key, Value, Hash, Equal >::ConstHashIterator():
   table_(nullptr),
-  ind_(0),
-  node_(nullptr)
+  ind_(0)
 {}
 
 template< class Key, class Value, class Hash, class Equal >
-abramov::ConstHashIterator< Key, Value, Hash, Equal >::ConstHashIterator(cHash *t, size_t i, const HashNode< Key, Value > *n):
+abramov::ConstHashIterator< Key, Value, Hash, Equal >::ConstHashIterator(cHash *t, size_t i):
   table_(t),
-  ind_(i),
-  node_(n)
+  ind_(i)
 {}
 
 template< class Key, class Value, class Hash, class Equal >
 abramov::ConstHashIterator< Key, Value, Hash, Equal > &abramov::ConstHashIterator< Key, Value, Hash, Equal >::operator++() noexcept
 {
-  if (node_)
+  if (table_ && ind_ < table_->capacity_)
   {
-    node_ = node_->next_;
-    if (!node_)
-    {
-      goNext();
-    }
+    goNext();
   }
   return *this;
 }
@@ -66,19 +59,7 @@ abramov::ConstHashIterator< Key, Value, Hash, Equal > &abramov::ConstHashIterato
 template< class Key, class Value, class Hash, class Equal >
 void abramov::ConstHashIterator< Key, Value, Hash, Equal >::goNext() noexcept
 {
-  ++ind_;
-  while (ind_ < table_->capacity_ && !table_->table_[ind_])
-  {
-    ++ind_;
-  }
-  if (ind_ < table_->capacity_)
-  {
-    node_ = table_->table_[ind_];
-  }
-  else
-  {
-    node_ = nullptr;
-  }
+  ind_ = table_->nextFull(ind_ + 1);
 }
 
 template< class Key, class Value, class Hash, class Equal >
@@ -92,7 +73,7 @@ abramov::ConstHashIterator< Key, Value, Hash, Equal > abramov::ConstHashIterator
 template< class Key, class Value, class Hash, class Equal >
 bool abramov::ConstHashIterator< Key, Value, Hash, Equal >::operator==(cIter &rhs) const noexcept
 {
-  return node_ == rhs.node_;
+  return table_ == rhs.table_ && ind_ == rhs.ind_;
 }
 
 template< class Key, class Value, class Hash, class Equal >
@@ -104,12 +85,12 @@ bool abramov::ConstHashIterator< Key, Value, Hash, Equal >::operator!=(cIter &rh
 template< class Key, class Value, class Hash, class Equal >
 const std::pair< Key, Value > &abramov::ConstHashIterator< Key, Value, Hash, Equal >::operator*() const noexcept
 {
-  return node_->data_;
+  return table_->slots_[ind_];
 }
 
 template< class Key, class Value, class Hash, class Equal >
 const std::pair< Key, Value > *abramov::ConstHashIterator< Key, Value, Hash, Equal >::operator->() const noexcept
 {
-  return std::addressof(node_->data_);
+  return std::addressof(table_->slots_[ind_]);
 }
 #endif
@@ -1,8 +1,8 @@
 #ifndef ITERATOR_HPP
 #define ITERATOR_HPP
 #include <iterator>
+#include <memory>
 #include "decls.hpp"
-#include "hash_node.hpp"
 
 namespace abramov
 {
@@ -16,7 +16,7 @@ namespace abramov
     using Iter = const HashIterator< Key, Value, Hash, Equal >;
 
     HashIterator();
-    HashIterator(HashTable< Key, Value, Hash, Equal > *t, size_t i, HashNode< Key, Value > *n);
+    HashIterator(HashTable< Key, Value, Hash, Equal > *t, size_t i);
     HashIterator(const HashIterator< Key, Value, Hash, Equal > &iter) = default;
     ~HashIterator() = default;
     HashIterator< Key, Value, Hash, Equal > &operator=(const HashIterator< Key, Value, Hash, Equal > &iter) = default;
@@ -29,7 +29,6 @@ namespace abramov
   private:
     HashTable< Key, Value, Hash, Equal > *table_;
     size_t ind_;
-    HashNode< Key, Value > *node_;
 
     void goNext() noexcept;
   };
@@ -38,27 +37,21 @@ namespace abramov
 template< class Key, class Value, class Hash, class Equal >
 abramov::HashIterator< Key, Value, Hash, Equal >::HashIterator():
   table_(nullptr),
-  ind_(0),
-  node_(nullptr)
+  ind_(0)
 {}
 
 template< class Key, class Value, class Hash, class Equal >
-abramov::HashIterator< Key, Value, Hash, Equal >::HashIterator(HashT *t, size_t i, HashNode< Key, Value > *n):
+abramov::HashIterator< Key, Value, Hash, Equal >::HashIterator(HashT *t, size_t i):
   table_(t),
-  ind_(i),
-  node_(n)
+  ind_(i)
 {}
 
 template< class Key, class Value, class Hash, class Equal >
 abramov::HashIterator< Key, Value, Hash, Equal > &abramov::HashIterator< Key, Value, Hash, Equal >::operator++() noexcept
 {
-  if (node_)
+  if (table_ && ind_ < table_->capacity_)
   {
-    node_ = node_->next_;
-    if (!node_)
-    {
-      goNext();
-    }
+    goNext();
   }
   return *this;
 }
@@ -66,19 +59,7 @@ abramov::HashIterator< Key, Value, Hash, Equal > &abramov::HashIterator< Key, Va
 template< class Key, class Value, class Hash, class Equal >
 void abramov::HashIterator< Key, Value, Hash, Equal >::goNext() noexcept
 {
-  ++ind_;
-  while (ind_ < table_->capacity_ && !table_->table_[ind_])
-  {
-    ++ind_;
-  }
-  if (ind_ < table_->capacity_)
-  {
-    node_ = table_->table_[ind_];
-  }
-  else
-  {
-    node_ = nullptr;
-  }
+  ind_ = table_->nextFull(ind_ + 1);
 }
 
 template< class Key, class Value, class Hash, class Equal >
@@ -92,7 +73,7 @@ abramov::HashIterator< Key, Value, Hash, Equal > abramov::HashIterator< Key, Val
 template< class Key, class Value, class Hash, class Equal >
 bool abramov::HashIterator< Key, Value, Hash, Equal >::operator==(Iter &rhs) const noexcept
 {
-  return node_ == rhs.node_;
+  return table_ == rhs.table_ && ind_ == rhs.ind_;
 }
 
 template< class Key, class Value, class Hash, class Equal >
@@ -104,12 +85,12 @@ bool abramov::HashIterator< Key, Value, Hash, Equal >::operator!=(Iter &rhs) con
 template< class Key, class Value, class Hash, class Equal >
 std::pair< Key, Value > &abramov::HashIterator< Key, Value, Hash, Equal >::operator*() noexcept
 {
-  return node_->data_;
+  return table_->slots_[ind_];
 }
 
 template< class Key, class Value, class Hash, class Equal >
 std::pair< Key, Value > *abramov::HashIterator< Key, Value, Hash, Equal >::operator->() noexcept
 {
-  return std::addressof(node_->data_);
+  return std::addressof(table_->slots_[ind_]);
 }
 #endif
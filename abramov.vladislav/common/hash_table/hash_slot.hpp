@@ -0,0 +1,13 @@
+#ifndef HASH_SLOT_HPP
+#define HASH_SLOT_HPP
+
+namespace abramov
+{
+  enum class SlotState: unsigned char
+  {
+    Empty,
+    Full,
+    Deleted
+  };
+}
+#endif
@@ -1,11 +1,13 @@
 #ifndef HASH_TABLE_HPP
 #define HASH_TABLE_HPP
-#include <cmath>
 #include <cstddef>
 #include <algorithm>
 #include <functional>
+#include <new>
+#include <stdexcept>
+#include <utility>
 #include "decls.hpp"
-#include "hash_node.hpp"
+#include "hash_slot.hpp"
 #include "hash_iterator.hpp"
 #include "hash_cIterator.hpp"
 
@@ -39,30 +41,44 @@ namespace abramov
     bool empty() const noexcept;
 
   private:
-    HashNode< Key, Value > **table_;
+    static constexpr double max_load = 0.7;
+
+    std::pair< Key, Value > *slots_;
+    SlotState *states_;
     size_t capacity_;
     size_t size_;
+    size_t deleted_;
     Hash hash_;
     Equal equal_;
     friend struct HashIterator< Key, Value, Hash, Equal >;
     friend struct ConstHashIterator< Key, Value, Hash, Equal >;
 
+    HashTable(size_t capacity, const Hash &hash, const Equal &equal);
     void initTable();
+    void destroyTable() noexcept;
     void resizeIfNeed();
     void swap(HashTable< Key, Value, Hash, Equal > &other) noexcept;
     size_t findInsertPosition(const Key &k) const;
-    bool isPrime(size_t k) const noexcept;
+    size_t findPosition(const Key &k) const;
+    size_t nextFull(size_t i) const noexcept;
     size_t getLargerPrimeCapacity(size_t k) const noexcept;
   };
 }
 
 template< class Key, class Value, class Hash, class Equal >
 abramov::HashTable< Key, Value, Hash, Equal >::HashTable():
-  table_(nullptr),
-  capacity_(17),
+  HashTable(17, Hash(), Equal())
+{}
+
+template< class Key, class Value, class Hash, class Equal >
+abramov::HashTable< Key, Value, Hash, Equal >::HashTable(size_t capacity, const Hash &hash, const Equal &equal):
+  slots_(nullptr),
+  states_(nullptr),
+  capacity_(capacity),
   size_(0),
-  hash_(std::hash< Key >()),
-  equal_(std::equal_to< Key >())
+  deleted_(0),
+  hash_(hash),
+  equal_(equal)
 {
   initTable();
 }
@@ -70,39 +86,57 @@ abramov::HashTable< Key, Value, Hash, Equal >::HashTable():
 template< class Key, class Value, class Hash, class Equal >
 void abramov::HashTable< Key, Value, Hash, Equal >::initTable()
 {
-  table_ = new HashNode< Key, Value >*[capacity_];
+  states_ = new SlotState[capacity_];
+  std::fill(states_, states_ + capacity_, SlotState::Empty);
+  try
+  {
+    slots_ = static_cast< std::pair< Key, Value >* >(::operator new(capacity_ * sizeof(std::pair< Key, Value >)));
+  }
+  catch (...)
+  {
+    delete[] states_;
+    throw;
+  }
+}
+
+template< class Key, class Value, class Hash, class Equal >
+void abramov::HashTable< Key, Value, Hash, Equal >::destroyTable() noexcept
+{
   for (size_t i = 0; i < capacity_; ++i)
   {
-    table_[i] = nullptr;
+    if (states_[i] == SlotState::Full)
+    {
+      slots_[i].~pair();
+    }
   }
+  ::operator delete(slots_);
+  delete[] states_;
 }
 
 template< class Key, class Value, class Hash, class Equal >
 abramov::HashTable< Key, Value, Hash, Equal >::HashTable(cHash &other):
-  table_(nullptr),
-  capacity_(other.capacity_),
-  size_(0),
-  hash_(other.hash_),
-  equal_(other.equal_)
+  HashTable(other.capacity_, other.hash_, other.equal_)
 {
-  initTable();
-  for (size_t i = 0; i < other.capacity_; ++i)
+  for (size_t i = 0; i < capacity_; ++i)
   {
-    HashNode< Key, Value > *curr = other.table_[i];
-    while (curr)
+    if (other.states_[i] == SlotState::Full)
     {
-      insert(curr->data_.first, curr->data_.second);
-      curr = curr->next_;
+      new (slots_ + i) std::pair< Key, Value >(other.slots_[i]);
+      ++size_;
     }
+    states_[i] = other.states_[i];
   }
+  deleted_ = other.deleted_;
 }
 
 template< class Key, class Value, class Hash, class Equal >
 void abramov::HashTable< Key, Value, Hash, Equal >::swap(Hash_t &other) noexcept
 {
-  std::swap(table_, other.table_);
+  std::swap(slots_, other.slots_);
+  std::swap(states_, other.states_);
   std::swap(capacity_, other.capacity_);
   std::swap(size_, other.size_);
+  std::swap(deleted_, other.deleted_);
   std::swap(hash_, other.hash_);
   std::swap(equal_, other.equal_);
 }
@@ -122,17 +156,7 @@ abramov::HashTable< Key, Value, Hash, Equal >::operator=(cHash &other)
 template< class Key, class Value, class Hash, class Equal >
 abramov::HashTable< Key, Value, Hash, Equal >::~HashTable()
 {
-  for (size_t i = 0; i < capacity_; ++i)
-  {
-    HashNode< Key, Value > *curr = table_[i];
-    while (curr)
-    {
-      HashNode< Key, Value > *next = curr->next_;
-      delete curr;
-      curr = next;
-    }
-  }
-  delete[] table_;
+  destroyTable();
 }
 
 template< class Key, class Value, class Hash, class Equal >
@@ -140,26 +164,27 @@ void abramov::HashTable< Key, Value, Hash, Equal >::insert(const Key &k, const V
 {
   resizeIfNeed();
   size_t pos = findInsertPosition(k);
-  if (!table_[pos])
+  if (states_[pos] == SlotState::Full)
   {
-    table_[pos] = new HashNode< Key, Value >(k, v);
+    slots_[pos].second = v;
+    return;
   }
-  else
+  new (slots_ + pos) std::pair< Key, Value >(k, v);
+  if (states_[pos] == SlotState::Deleted)
   {
-    HashNode< Key, Value > *new_node = new HashNode< Key, Value >(k, v);
-    new_node->next_ = table_[pos];
-    table_[pos] = new_node;
+    --deleted_;
   }
+  states_[pos] = SlotState::Full;
   ++size_;
 }
 
 template< class Key, class Value, class Hash, class Equal >
 void abramov::HashTable< Key, Value, Hash, Equal >::resizeIfNeed()
 {
-  constexpr double max = 0.8;
-  if (loadFactor() > max)
+  if (size_ + deleted_ + 1 > max_load * capacity_)
   {
-    rehash(capacity_ * 2);
+    bool only_deleted = size_ + 1 <= max_load * capacity_ / 2;
+    rehash(only_deleted ? capacity_ : capacity_ + 1);
   }
 }
 
@@ -172,110 +197,120 @@ double abramov::HashTable< Key, Value, Hash, Equal >::loadFactor() const noexcep
 template< class Key, class Value, class Hash, class Equal >
 void abramov::HashTable< Key, Value, Hash, Equal >::rehash(size_t k)
 {
-  HashNode< Key, Value > **old_table = table_;
-  size_t old_capacity = capacity_;
-  capacity_ = k;
-  size_ = 0;
-  initTable();
-  for (size_t i = 0; i < old_capacity; ++i)
+  size_t min_capacity = static_cast< size_t >(size_ / max_load) + 1;
+  HashTable< Key, Value, Hash, Equal > temp(getLargerPrimeCapacity(std::max(k, min_capacity)), hash_, equal_);
+  for (size_t i = 0; i < capacity_; ++i)
   {
-    HashNode< Key, Value > *curr = old_table[i];
-    while (curr)
+    if (states_[i] == SlotState::Full)
     {
-      insert(curr->data_.first, curr->data_.second);
-      HashNode< Key, Value > *next = curr->next_;
-      delete curr;
-      curr = next;
+      size_t pos = temp.findInsertPosition(slots_[i].first);
+      new (temp.slots_ + pos) std::pair< Key, Value >(std::move_if_noexcept(slots_[i]));
+      temp.states_[pos] = SlotState::Full;
+      ++temp.size_;
     }
   }
-  delete[] old_table;
+  swap(temp);
 }
 
 template< class Key, class Value, class Hash, class Equal >
 size_t abramov::HashTable< Key, Value, Hash, Equal >::findInsertPosition(const Key &k) const
 {
   size_t pos = hash_(k) % capacity_;
-  size_t att = 0;
-  while (table_[pos] && !equal_(table_[pos]->data_.first, k))
+  size_t deleted = capacity_;
+  while (states_[pos] != SlotState::Empty)
   {
-    pos = (pos + att * att) % capacity_;
-    ++att;
+    if (states_[pos] == SlotState::Full)
+    {
+      if (equal_(slots_[pos].first, k))
+      {
+        return pos;
+      }
+    }
+    else if (deleted == capacity_)
+    {
+      deleted = pos;
+    }
+    pos = pos + 1 == capacity_ ? 0 : pos + 1;
   }
-  return pos;
+  return deleted == capacity_ ? pos : deleted;
 }
 
 template< class Key, class Value, class Hash, class Equal >
-size_t abramov::HashTable< Key, Value, Hash, Equal >::erase(const Key &k)
+size_t abramov::HashTable< Key, Value, Hash, Equal >::findPosition(const Key &k) const
 {
-  size_t removed = 0;
-  size_t orig_pos = hash_(k) % capacity_;
-  size_t pos = orig_pos;
-  size_t att = 0;
-  do
+  size_t pos = hash_(k) % capacity_;
+  while (states_[pos] != SlotState::Empty)
   {
-    HashNode< Key, Value > *curr = table_[pos];
-    HashNode< Key, Value > *prev = nullptr;
-    while (curr)
+    if (states_[pos] == SlotState::Full && equal_(slots_[pos].first, k))
     {
-      if (equal_(curr->data_.first, k))
-      {
-        HashNode< Key, Value > *del = curr;
-        if (prev)
-        {
-          prev->next_ = curr->next_;
-        }
-        else
-        {
-          table_[pos] = curr->next_;
-        }
-        curr = curr->next_;
-        delete del;
-        ++removed;
-        --size_;
-      }
-      else
-      {
-        prev = curr;
-        curr = curr->next_;
-      }
+      return pos;
     }
-    ++att;
-    pos = (orig_pos + att * att) % capacity_;
-  } while (pos != orig_pos);
-  return removed;
+    pos = pos + 1 == capacity_ ? 0 : pos + 1;
+  }
+  return capacity_;
+}
+
+template< class Key, class Value, class Hash, class Equal >
+size_t abramov::HashTable< Key, Value, Hash, Equal >::nextFull(size_t i) const noexcept
+{
+  while (i < capacity_ && states_[i] != SlotState::Full)
+  {
+    ++i;
+  }
+  return i;
+}
+
+template< class Key, class Value, class Hash, class Equal >
+size_t abramov::HashTable< Key, Value, Hash, Equal >::erase(const Key &k)
+{
+  if (empty())
+  {
+    return 0;
+  }
+  size_t pos = findPosition(k);
+  if (pos == capacity_)
+  {
+    return 0;
+  }
+  slots_[pos].~pair();
+  --size_;
+  size_t next = pos + 1 == capacity_ ? 0 : pos + 1;
+  if (states_[next] == SlotState::Empty)
+  {
+    states_[pos] = SlotState::Empty;
+  }
+  else
+  {
+    states_[pos] = SlotState::Deleted;
+    ++deleted_;
+  }
+  return 1;
 }
 
 template< class Key, class Value, class Hash, class Equal >
 Value &abramov::HashTable< Key, Value, Hash, Equal >::operator[](const Key &k)
 {
-  auto it = find(k);
-  if (it != end())
+  size_t pos = findPosition(k);
+  if (pos == capacity_)
   {
-    return it->second;
+    insert(k, Value());
+    pos = findPosition(k);
   }
-  insert(k, Value());
-  return find(k)->second;
+  return slots_[pos].second;
 }
 
 template< class Key, class Value, class Hash, class Equal >
 typename abramov::HashTable< Key, Value, Hash, Equal >::Iter
 abramov::HashTable< Key, Value, Hash, Equal >::end()
 {
-  return HashIterator< Key, Value, Hash, Equal >(this, capacity_, nullptr);
+  return HashIterator< Key, Value, Hash, Equal >(this, capacity_);
 }
 
 template< class Key, class Value, class Hash, class Equal >
 typename abramov::HashTable< Key, Value, Hash, Equal >::Iter
 abramov::HashTable< Key, Value, Hash, Equal >::begin()
 {
-  for (size_t i = 0; i < capacity_; ++i)
-  {
-    if (table_[i])
-    {
-      return HashIterator< Key, Value, Hash, Equal >(this, i, table_[i]);
-    }
-  }
-  return end();
+  return HashIterator< Key, Value, Hash, Equal >(this, nextFull(0));
 }
 
 template< class Key, class Value, class Hash, class Equal >
@@ -286,45 +321,21 @@ abramov::HashTable< Key, Value, Hash, Equal >::find(const Key & k)
   {
     return end();
   }
-  size_t pos = hash_(k) % capacity_;
-  size_t att = 0;
-  size_t orig_pos = pos;
-  do
-  {
-    HashNode< Key, Value > *curr = table_[pos];
-    while (curr)
-    {
-      if (equal_(curr->data_.first, k))
-      {
-        return HashIterator< Key, Value, Hash, Equal >(this, pos, curr);
-      }
-      curr = curr->next_;
-    }
-    ++att;
-    pos = (orig_pos + att * att) % capacity_;
-  } while (pos != orig_pos);
-  return end();
+  return HashIterator< Key, Value, Hash, Equal >(this, findPosition(k));
 }
 
 template< class Key, class Value, class Hash, class Equal >
 typename abramov::HashTable< Key, Value, Hash, Equal >::cIter
 abramov::HashTable< Key, Value, Hash, Equal >::cend() const
 {
-  return ConstHashIterator< Key, Value, Hash, Equal >(this, capacity_, nullptr);
+  return ConstHashIterator< Key, Value, Hash, Equal >(this, capacity_);
 }
 
 template< class Key, class Value, class Hash, class Equal >
 typename abramov::HashTable< Key, Value, Hash, Equal >::cIter
 abramov::HashTable< Key, Value, Hash, Equal >::cbegin() const
 {
-  for (size_t i = 0; i < capacity_; ++i)
-  {
-    if (table_[i])
-    {
-      return ConstHashIterator< Key, Value, Hash, Equal >(this, i, table_[i]);
-    }
-  }
-  return cend();
+  return ConstHashIterator< Key, Value, Hash, Equal >(this, nextFull(0));
 }
 
 template< class Key, class Value, class Hash, class Equal >
@@ -335,24 +346,7 @@ abramov::HashTable< Key, Value, Hash, Equal >::cfind(const Key & k) const
   {
     return cend();
   }
-  size_t pos = hash_(k) % capacity_;
-  size_t att = 0;
-  size_t orig_pos = pos;
-  do
-  {
-    HashNode< Key, Value > *curr = table_[pos];
-    while (curr)
-    {
-      if (equal_(curr->data_.first, k))
-      {
-        return ConstHashIterator< Key, Value, Hash, Equal >(this, pos, curr);
-      }
-      curr = curr->next_;
-    }
-    ++att;
-    pos = (orig_pos + att * att) % capacity_;
-  } while (pos != orig_pos);
-  return cend();
+  return ConstHashIterator< Key, Value, Hash, Equal >(this, findPosition(k));
 }
 
 template< class Key, class Value, class Hash, class Equal >
@@ -379,35 +373,15 @@ bool abramov::HashTable< Key, Value, Hash, Equal >::empty() const noexcept
   return size_ == 0;
 }
 
-template< class Key, class Value, class Hash, class Equal >
-bool abramov::HashTable< Key, Value, Hash, Equal >::isPrime(size_t k) const noexcept
-{
-  if (k % 2 == 0)
-  {
-    return true;
-  }
-  for (size_t i = 3; i < static_cast< int >(std::ceil(std::sqrt(k))); ++i)
-  {
-    if (k % i == 0)
-    {
-      return false;
-    }
-  }
-  return true;
-}
-
 template< class Key, class Value, class Hash, class Equal >
 size_t abramov::HashTable< Key, Value, Hash, Equal >::getLargerPrimeCapacity(size_t k) const noexcept
 {
-  size_t cand = 2 * cand + 1;
-  while (true)
-  {
-    if (isPrime(cand))
-    {
-      return cand;
-    }
-    ++cand;
-  }
+  static constexpr size_t primes[] = {
+    17, 37, 79, 163, 331, 673, 1361, 2729, 5471, 10949, 21911, 43853, 87719, 175447, 350899, 701819,
+    1403641, 2807303, 5614657, 11229331, 22458671, 44917381, 89834777, 179669557, 359339171, 718678369,
+    1437356741, 2874713497
+  };
+  const size_t *cand = std::lower_bound(std::begin(primes), std::end(primes), k);
+  return cand == std::end(primes) ? k | 1 : *cand;
 }
 #endif
-
@@ -61,7 +61,7 @@ int main(int args, char** argv)
     std::string round = argv[1];
     TreeSum result;
     TwoThreeTree< std::string, std::function< TreeSum(TreeSum) >, std::less< std::string > > commandset{
-      {"ascending", CallTraverse< DatasetType, TreeSum >{dataset, &DatasetType::traverse_lnr}},
+      {"ascending", CallTraverse< DatasetType, TreeSum >{dataset, &DatasetType::traverse_reduce}},
       {"descending", CallTraverse< DatasetType, TreeSum >{dataset, &DatasetType::traverse_rnl}},
       {"breadth", CallTraverse< DatasetType, TreeSum >{dataset, &DatasetType::traverse_breadth}}
     };
@@ -1,3 +1,6 @@
+#include <limits>
+#include <stdexcept>
+#include <string>
 #include <boost/test/unit_test.hpp>
 #include <tree/tree-2-3.hpp>
 #include "tree-sum-functor.hpp"
@@ -47,3 +50,54 @@ BOOST_AUTO_TEST_CASE(test_traverses)
   BOOST_TEST(result3.values.front() == "c");
   result3.values.pop();
 }
+
+BOOST_AUTO_TEST_CASE(test_traverse_reduce)
+{
+  using namespace alymova;
+  using Tree = alymova::TwoThreeTree< int, std::string, std::less< int > >;
+
+  Tree tree;
+  BOOST_TEST(tree.traverse_reduce(TreeSum(), 4).keys == 0);
+  for (int i = 0; i < 1000; ++i)
+  {
+    tree.emplace(i % 2 ? i : -i, std::to_string(i));
+  }
+
+  TreeSum expected = tree.traverse_lnr(TreeSum());
+  TreeSum result = tree.traverse_reduce(TreeSum(), 4);
+  BOOST_TEST(result.keys == expected.keys);
+  BOOST_TEST(result.values.size() == expected.values.size());
+  while (!expected.values.empty())
+  {
+    BOOST_TEST(result.values.front() == expected.values.front());
+    result.values.pop();
+    expected.values.pop();
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_traverse_reduce_overflow)
+{
+  using namespace alymova;
+  using Tree = alymova::TwoThreeTree< int, std::string, std::less< int > >;
+
+  const int max = std::numeric_limits< int >::max();
+  const int min = std::numeric_limits< int >::min();
+  Tree tree;
+  tree.emplace(min + 10, "min");
+  for (int i = 1; i <= 1000; ++i)
+  {
+    tree.emplace(i, std::to_string(i));
+  }
+  for (int i = 1; i <= 3; ++i)
+  {
+    tree.emplace((1 << 30) + i, std::to_string(i));
+  }
+  TreeSum expected = tree.traverse_lnr(TreeSum());
+  TreeSum result = tree.traverse_reduce(TreeSum(), 4);
+  BOOST_TEST(result.keys == expected.keys);
+  BOOST_TEST(result.values.size() == expected.values.size());
+
+  tree.emplace(max - 1, "max");
+  BOOST_CHECK_THROW(tree.traverse_lnr(TreeSum()), std::logic_error);
+  BOOST_CHECK_THROW(tree.traverse_reduce(TreeSum(), 4), std::logic_error);
+}
@@ -1,10 +1,13 @@
 #include "tree-sum-functor.hpp"
+#include <algorithm>
 #include <exception>
 #include <limits>
 
 alymova::TreeSum::TreeSum():
   keys(0),
-  values()
+  values(),
+  min_keys_(0),
+  max_keys_(0)
 {}
 
 void alymova::TreeSum::operator()(const std::pair< int, std::string >& key_value)
@@ -14,8 +17,26 @@ void alymova::TreeSum::operator()(const std::pair< int, std::string >& key_value
     throw std::logic_error("<SUM OVERFLOW>");
   }
   keys += key_value.first;
+  min_keys_ = std::min(min_keys_, keys);
+  max_keys_ = std::max(max_keys_, keys);
   values.push(key_value.second);
 }
+
+void alymova::TreeSum::join(TreeSum&& other)
+{
+  if (isOverflowAddition(keys, other.min_keys_) || isOverflowAddition(keys, other.max_keys_))
+  {
+    throw std::logic_error("<SUM OVERFLOW>");
+  }
+  min_keys_ = std::min(min_keys_, keys + other.min_keys_);
+  max_keys_ = std::max(max_keys_, keys + other.max_keys_);
+  keys += other.keys;
+  while (!other.values.empty())
+  {
+    values.push(std::move(other.values.front()));
+    other.values.pop();
+  }
+}
 std::ostream& alymova::operator<<(std::ostream& out, const TreeSum& object)
 {
   std::ostream::sentry s(out);
@@ -32,10 +53,10 @@ std::ostream& alymova::operator<<(std::ostream& out, const TreeSum& object)
   }
   return out;
 }
-bool alymova::isOverflowAddition(long long int lhs, long long int rhs)
+bool alymova::isOverflowAddition(int lhs, int rhs)
 {
-  const long long int max_sum = std::numeric_limits< long long int >::max();
-  const long long int min_sum = std::numeric_limits< long long int >::min();
+  const int max_sum = std::numeric_limits< int >::max();
+  const int min_sum = std::numeric_limits< int >::min();
   if (lhs > 0 && rhs > 0)
   {
     return ((max_sum - rhs) < lhs);
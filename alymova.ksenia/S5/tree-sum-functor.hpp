@@ -1,6 +1,7 @@
 #ifndef TREE_SUM_FUNCTOR_HPP
 #define TREE_SUM_FUNCTOR_HPP
 #include <iostream>
+#include <type_traits>
 #include <utility>
 #include <queue.hpp>
 
@@ -8,13 +9,20 @@ namespace alymova
 {
   struct TreeSum
   {
+    using is_associative = std::true_type;
+
     int keys;
     Queue< std::string > values;
 
     TreeSum();
     void operator()(const std::pair< int, std::string >& key_value);
+    void join(TreeSum&& other);
+
+  private:
+    int min_keys_;
+    int max_keys_;
   };
   std::ostream& operator<<(std::ostream& out, const TreeSum& object);
-  bool isOverflowAddition(long long int lhs, long long int rhs);
+  bool isOverflowAddition(int lhs, int rhs);
 }
 #endif
@@ -10,6 +10,7 @@
 #include "tree-lnr-iterator.hpp"
 #include "tree-rnl-iterator.hpp"
 #include "tree-breadth-iterator.hpp"
+#include "tree-reduce.hpp"
 
 namespace alymova
 {
@@ -60,6 +61,13 @@ namespace alymova
     template< class F >
     F traverse_breadth(F f) const;
 
+    template< class F >
+    F traverse_reduce(F f);
+    template< class F >
+    F traverse_reduce(F f) const;
+    template< class F >
+    F traverse_reduce(F f, size_t threads) const;
+
     Iterator begin() noexcept;
     ConstIterator begin() const noexcept;
     ConstIterator cbegin() const noexcept;
@@ -126,6 +134,13 @@ namespace alymova
     void distribute_erase(Node* node);
     Node* merge_erase(Node* node);
 
+    static constexpr size_t min_parallel_size = 1 << 16;
+
+    template< class F >
+    F traverse_reduce(F f, size_t threads, std::true_type) const;
+    template< class F >
+    F traverse_reduce(F f, size_t threads, std::false_type) const;
+
     bool is_balanced() const noexcept;
     size_t find_height(Node* node) const noexcept;
   };
@@ -412,6 +427,49 @@ namespace alymova
     return f;
   }
 
+  template< class Key, class Value, class Comparator >
+  template< class F >
+  F TwoThreeTree< Key, Value, Comparator >::traverse_reduce(F f)
+  {
+    return static_cast< const TwoThreeTree& >(*this).traverse_reduce(f);
+  }
+
+  template< class Key, class Value, class Comparator >
+  template< class F >
+  F TwoThreeTree< Key, Value, Comparator >::traverse_reduce(F f) const
+  {
+    if (size_ < min_parallel_size)
+    {
+      return traverse_lnr(f);
+    }
+    return traverse_reduce(f, std::thread::hardware_concurrency());
+  }
+
+  template< class Key, class Value, class Comparator >
+  template< class F >
+  F TwoThreeTree< Key, Value, Comparator >::traverse_reduce(F f, size_t threads) const
+  {
+    return traverse_reduce(f, threads, detail::IsAssociative< F >{});
+  }
+
+  template< class Key, class Value, class Comparator >
+  template< class F >
+  F TwoThreeTree< Key, Value, Comparator >::traverse_reduce(F f, size_t threads, std::true_type) const
+  {
+    if (threads < 2 || size_ == 0)
+    {
+      return traverse_lnr(f);
+    }
+    return detail::reduceParallel(static_cast< const Node* >(root_), f, threads);
+  }
+
+  template< class Key, class Value, class Comparator >
+  template< class F >
+  F TwoThreeTree< Key, Value, Comparator >::traverse_reduce(F f, size_t, std::false_type) const
+  {
+    return traverse_lnr(f);
+  }
+
   template< class Key, class Value, class Comparator >
   size_t TwoThreeTree< Key, Value, Comparator >::size() const noexcept
   {
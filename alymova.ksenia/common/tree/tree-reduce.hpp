@@ -0,0 +1,194 @@
+#ifndef TREE_REDUCE_HPP
+#define TREE_REDUCE_HPP
+#include <cstddef>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include "tree-node.hpp"
+
+namespace alymova
+{
+  namespace detail
+  {
+    template< class... >
+    struct MakeVoid
+    {
+      using type = void;
+    };
+
+    template< class F, class = void >
+    struct IsAssociative: std::false_type
+    {};
+
+    template< class F >
+    struct IsAssociative< F, typename MakeVoid< typename F::is_associative >::type >:
+      std::integral_constant< bool, F::is_associative::value >
+    {};
+
+    template< class Node >
+    struct ReduceItem
+    {
+      const Node* node;
+      bool subtree;
+      size_t index;
+    };
+
+    template< class Node >
+    bool isRealNode(const Node* node) noexcept
+    {
+      return node && node->type != Node::NodeType::Fake && node->type != Node::NodeType::Empty;
+    }
+
+    template< class Node, class F >
+    void reduceSubtree(const Node* node, F& f)
+    {
+      if (!isRealNode(node))
+      {
+        return;
+      }
+      reduceSubtree(node->left, f);
+      f(node->data[0]);
+      if (node->type == Node::NodeType::Triple)
+      {
+        reduceSubtree(node->mid, f);
+        f(node->data[1]);
+      }
+      reduceSubtree(node->right, f);
+    }
+
+    template< class Node >
+    size_t countSubtrees(const Node* node, size_t depth) noexcept
+    {
+      if (!isRealNode(node))
+      {
+        return 0;
+      }
+      if (depth == 0 || node->isLeaf())
+      {
+        return 1;
+      }
+      size_t count = countSubtrees(node->left, depth - 1) + countSubtrees(node->right, depth - 1);
+      if (node->type == Node::NodeType::Triple)
+      {
+        count += countSubtrees(node->mid, depth - 1);
+      }
+      return count;
+    }
+
+    template< class Node >
+    size_t countItems(const Node* node, size_t depth) noexcept
+    {
+      if (!isRealNode(node))
+      {
+        return 0;
+      }
+      if (depth == 0 || node->isLeaf())
+      {
+        return 1;
+      }
+      size_t count = countItems(node->left, depth - 1) + countItems(node->right, depth - 1) + 1;
+      if (node->type == Node::NodeType::Triple)
+      {
+        count += countItems(node->mid, depth - 1) + 1;
+      }
+      return count;
+    }
+
+    template< class Node >
+    ReduceItem< Node >* collectItems(const Node* node, size_t depth, ReduceItem< Node >* out) noexcept
+    {
+      if (!isRealNode(node))
+      {
+        return out;
+      }
+      if (depth == 0 || node->isLeaf())
+      {
+        *out = {node, true, 0};
+        return ++out;
+      }
+      out = collectItems(node->left, depth - 1, out);
+      *(out++) = {node, false, 0};
+      if (node->type == Node::NodeType::Triple)
+      {
+        out = collectItems(node->mid, depth - 1, out);
+        *(out++) = {node, false, 1};
+      }
+      return collectItems(node->right, depth - 1, out);
+    }
+
+    template< class Node, class F >
+    F reduceParallel(const Node* root, F f, size_t threads)
+    {
+      const size_t target = threads * 4;
+      size_t depth = 0;
+      size_t subtrees = countSubtrees(root, depth);
+      while (subtrees < target && countSubtrees(root, depth + 1) > subtrees)
+      {
+        subtrees = countSubtrees(root, ++depth);
+      }
+      const size_t count = countItems(root, depth);
+      std::unique_ptr< ReduceItem< Node >[] > items(new ReduceItem< Node >[count]);
+      collectItems(root, depth, items.get());
+      std::unique_ptr< F[] > partials(new F[count]);
+      std::unique_ptr< std::exception_ptr[] > errors(new std::exception_ptr[count]);
+
+      std::atomic< size_t > next(0);
+      auto work = [&items, &partials, &errors, &next, count]()
+      {
+        for (size_t i = next++; i < count; i = next++)
+        {
+          if (!items[i].subtree)
+          {
+            continue;
+          }
+          try
+          {
+            reduceSubtree(items[i].node, partials[i]);
+          }
+          catch (...)
+          {
+            errors[i] = std::current_exception();
+          }
+        }
+      };
+      std::unique_ptr< std::thread[] > workers(new std::thread[threads - 1]);
+      size_t started = 0;
+      try
+      {
+        for (; started < threads - 1; ++started)
+        {
+          workers[started] = std::thread(work);
+        }
+      }
+      catch (const std::system_error&)
+      {}
+      work();
+      for (size_t i = 0; i < started; ++i)
+      {
+        workers[i].join();
+      }
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        if (!items[i].subtree)
+        {
+          f(items[i].node->data[items[i].index]);
+          continue;
+        }
+        if (errors[i])
+        {
+          reduceSubtree(items[i].node, f);
+          continue;
+        }
+        f.join(std::move(partials[i]));
+      }
+      return f;
+    }
+  }
+}
+
+#endif
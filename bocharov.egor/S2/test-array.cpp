@@ -16,6 +16,21 @@ BOOST_AUTO_TEST_CASE(constructors)
   BOOST_TEST(moveArr.front() == 1);
 }
 
+BOOST_AUTO_TEST_CASE(copy_after_pop_front)
+{
+  bocharov::Array< int > arr;
+  for (int i = 0; i < 4; ++i)
+  {
+    arr.push(i);
+  }
+  arr.popFront();
+  arr.popFront();
+  bocharov::Array< int > copyArr(arr);
+  BOOST_TEST(copyArr.size() == 2);
+  BOOST_TEST(copyArr.front() == 2);
+  BOOST_TEST(copyArr.back() == 3);
+}
+
 BOOST_AUTO_TEST_CASE(assignment_operators)
 {
   bocharov::Array< int > arr;
@@ -27,3 +27,45 @@ BOOST_AUTO_TEST_CASE(traverse)
   iss << funBreadth.sum << funBreadth.str;
   BOOST_TEST(iss.str() == "45 a b c d e");
 }
+
+BOOST_AUTO_TEST_CASE(breadth_cursor)
+{
+  Tree< int, std::string > tree;
+  for (int i = 0; i < 100; ++i)
+  {
+    tree.insert({ (i * 37) % 100, std::to_string(i) });
+  }
+  Tree< int, std::string >::BreadthBuffer buffer;
+  Tree< int, std::string >::ConstBreadthIterator expected = tree.breadthCbegin();
+  size_t count = 0;
+  for (auto it = tree.breadthCbegin(buffer); it != tree.breadthCend(buffer); ++it)
+  {
+    BOOST_TEST(it->first == expected->first);
+    ++expected;
+    ++count;
+  }
+  BOOST_TEST(count == tree.size());
+  BOOST_TEST((expected == tree.breadthCend()));
+  BOOST_TEST(buffer.capacity() <= tree.size());
+  const size_t capacity = buffer.capacity();
+  tree.erase(50);
+  count = 0;
+  for (auto it = tree.breadthBegin(buffer); it != tree.breadthEnd(buffer); ++it)
+  {
+    it->second += "!";
+    ++count;
+  }
+  BOOST_TEST(count == tree.size());
+  BOOST_TEST(buffer.capacity() == capacity);
+  BOOST_TEST(tree.at(0) == "0!");
+}
+
+BOOST_AUTO_TEST_CASE(breadth_cursor_empty)
+{
+  Tree< int, std::string > tree;
+  Tree< int, std::string >::BreadthBuffer buffer;
+  BOOST_TEST((tree.breadthBegin(buffer) == tree.breadthEnd(buffer)));
+  KeySum fun;
+  fun = tree.traverse_breadth(fun);
+  BOOST_TEST(fun.sum == 0);
+}
@@ -81,13 +81,13 @@ namespace bocharov
     data_(new T [arr.capacity_]),
     capacity_(arr.capacity_),
     size_(arr.size_),
-    begin_(arr.begin_)
+    begin_(0)
   {
     try
     {
       for (size_t i = 0; i < size_; ++i)
       {
-        data_[i] = arr.data_[i + begin_];
+        data_[i] = arr.data_[i + arr.begin_];
       }
     }
     catch (...)
@@ -191,7 +191,7 @@ namespace bocharov
   template< typename T >
   void Array< T >::push(const T & data) noexcept
   {
-    if (size_ >= capacity_)
+    if (begin_ + size_ >= capacity_)
     {
       reallocate();
     }
@@ -202,7 +202,7 @@ namespace bocharov
   template< typename T >
   void Array< T >::push(T && data) noexcept
   {
-    if (size_ >= capacity_)
+    if (begin_ + size_ >= capacity_)
     {
       reallocate();
     }
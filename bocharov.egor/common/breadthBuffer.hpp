@@ -0,0 +1,141 @@
+#ifndef BREADTHBUFFER_HPP
+#define BREADTHBUFFER_HPP
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+namespace bocharov
+{
+  namespace detail
+  {
+    template< typename Node >
+    class BreadthBuffer
+    {
+    public:
+      BreadthBuffer() noexcept;
+      BreadthBuffer(const BreadthBuffer< Node > &) = delete;
+      BreadthBuffer(BreadthBuffer< Node > &&) noexcept;
+      ~BreadthBuffer();
+
+      BreadthBuffer< Node > & operator=(const BreadthBuffer< Node > &) = delete;
+      BreadthBuffer< Node > & operator=(BreadthBuffer< Node > &&) noexcept;
+
+      void reset(size_t);
+      void push(Node *);
+      Node * pop() noexcept;
+
+      size_t capacity() const noexcept;
+      bool empty() const noexcept;
+
+    private:
+      Node ** data_;
+      size_t capacity_;
+      size_t size_;
+      size_t begin_;
+
+      void reallocate(size_t);
+      void swap(BreadthBuffer< Node > &) noexcept;
+    };
+
+    template< typename Node >
+    BreadthBuffer< Node >::BreadthBuffer() noexcept:
+      data_(nullptr),
+      capacity_(0),
+      size_(0),
+      begin_(0)
+    {}
+
+    template< typename Node >
+    BreadthBuffer< Node >::BreadthBuffer(BreadthBuffer< Node > && oth) noexcept:
+      data_(std::exchange(oth.data_, nullptr)),
+      capacity_(std::exchange(oth.capacity_, 0)),
+      size_(std::exchange(oth.size_, 0)),
+      begin_(std::exchange(oth.begin_, 0))
+    {}
+
+    template< typename Node >
+    BreadthBuffer< Node >::~BreadthBuffer()
+    {
+      delete[] data_;
+    }
+
+    template< typename Node >
+    BreadthBuffer< Node > & BreadthBuffer< Node >::operator=(BreadthBuffer< Node > && oth) noexcept
+    {
+      BreadthBuffer< Node > temp(std::move(oth));
+      swap(temp);
+      return *this;
+    }
+
+    template< typename Node >
+    void BreadthBuffer< Node >::reset(size_t capacity)
+    {
+      size_ = 0;
+      begin_ = 0;
+      if (capacity > capacity_)
+      {
+        reallocate(capacity);
+      }
+    }
+
+    template< typename Node >
+    void BreadthBuffer< Node >::push(Node * node)
+    {
+      if (size_ == capacity_)
+      {
+        reallocate(capacity_ == 0 ? 1 : capacity_ * 2);
+      }
+      size_t end = begin_ + size_;
+      data_[end < capacity_ ? end : end - capacity_] = node;
+      ++size_;
+    }
+
+    template< typename Node >
+    Node * BreadthBuffer< Node >::pop() noexcept
+    {
+      assert(!empty());
+      Node * node = data_[begin_];
+      begin_ = begin_ + 1 == capacity_ ? 0 : begin_ + 1;
+      --size_;
+      return node;
+    }
+
+    template< typename Node >
+    size_t BreadthBuffer< Node >::capacity() const noexcept
+    {
+      return capacity_;
+    }
+
+    template< typename Node >
+    bool BreadthBuffer< Node >::empty() const noexcept
+    {
+      return size_ == 0;
+    }
+
+    template< typename Node >
+    void BreadthBuffer< Node >::reallocate(size_t capacity)
+    {
+      Node ** data = new Node * [capacity];
+      for (size_t i = 0; i < size_; ++i)
+      {
+        size_t pos = begin_ + i;
+        data[i] = data_[pos < capacity_ ? pos : pos - capacity_];
+      }
+      delete[] data_;
+      data_ = data;
+      capacity_ = capacity;
+      begin_ = 0;
+    }
+
+    template< typename Node >
+    void BreadthBuffer< Node >::swap(BreadthBuffer< Node > & oth) noexcept
+    {
+      std::swap(data_, oth.data_);
+      std::swap(capacity_, oth.capacity_);
+      std::swap(size_, oth.size_);
+      std::swap(begin_, oth.begin_);
+    }
+  }
+}
+
+#endif
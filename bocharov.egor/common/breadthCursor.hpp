@@ -0,0 +1,125 @@
+#ifndef BREADTHCURSOR_HPP
+#define BREADTHCURSOR_HPP
+#include <cassert>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include "node.hpp"
+#include "breadthBuffer.hpp"
+
+namespace bocharov
+{
+  template< typename Key, typename Value, typename Cmp >
+  class Tree;
+
+  namespace detail
+  {
+    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    class BreadthCursor: public std::iterator< std::input_iterator_tag, std::pair< Key, Value > >
+    {
+    public:
+      using value = std::pair< Key, Value >;
+      using reference = std::conditional_t< IsConst, const value &, value & >;
+      using pointer = std::conditional_t< IsConst, const value *, value * >;
+      using Node = TreeNode< Key, Value >;
+      using Buffer = BreadthBuffer< Node >;
+
+      BreadthCursor() noexcept;
+      template < bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > = 0 >
+      BreadthCursor(const BreadthCursor< Key, Value, Cmp, OtherIsConst > &) noexcept;
+
+      BreadthCursor< Key, Value, Cmp, IsConst > & operator++();
+
+      reference operator*() const noexcept;
+      pointer operator->() const noexcept;
+
+      bool operator==(const BreadthCursor< Key, Value, Cmp, IsConst > &) const noexcept;
+      bool operator!=(const BreadthCursor< Key, Value, Cmp, IsConst > &) const noexcept;
+    private:
+      Node * node_;
+      Buffer * buffer_;
+      BreadthCursor(Node *, Buffer *);
+      void pushChildren();
+      friend class BreadthCursor< Key, Value, Cmp, !IsConst >;
+      friend class Tree< Key, Value, Cmp >;
+    };
+
+    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    BreadthCursor< Key, Value, Cmp, IsConst >::BreadthCursor() noexcept:
+      node_(nullptr),
+      buffer_(nullptr)
+    {}
+
+    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    template< bool OtherIsConst, std::enable_if_t< IsConst && !OtherIsConst, int > >
+    BreadthCursor< Key, Value, Cmp, IsConst >::BreadthCursor(const BreadthCursor< Key, Value, Cmp, OtherIsConst > & oth) noexcept:
+      node_(oth.node_),
+      buffer_(oth.buffer_)
+    {}
+
+    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    BreadthCursor< Key, Value, Cmp, IsConst >::BreadthCursor(Node * node, Buffer * buffer):
+      node_(node),
+      buffer_(buffer)
+    {
+      if (node_)
+      {
+        pushChildren();
+      }
+    }
+
+    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    BreadthCursor< Key, Value, Cmp, IsConst > & BreadthCursor< Key, Value, Cmp, IsConst >::operator++()
+    {
+      assert(node_ != nullptr);
+      if (buffer_->empty())
+      {
+        node_ = nullptr;
+        return *this;
+      }
+      node_ = buffer_->pop();
+      pushChildren();
+      return *this;
+    }
+
+    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    typename BreadthCursor< Key, Value, Cmp, IsConst >::reference BreadthCursor< Key, Value, Cmp, IsConst >::operator*() const noexcept
+    {
+      assert(node_ != nullptr);
+      return node_->data;
+    }
+
+    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    typename BreadthCursor< Key, Value, Cmp, IsConst >::pointer BreadthCursor< Key, Value, Cmp, IsConst >::operator->() const noexcept
+    {
+      assert(node_ != nullptr);
+      return std::addressof(node_->data);
+    }
+
+    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    bool BreadthCursor< Key, Value, Cmp, IsConst >::operator==(const BreadthCursor< Key, Value, Cmp, IsConst > & oth) const noexcept
+    {
+      return node_ == oth.node_;
+    }
+
+    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    bool BreadthCursor< Key, Value, Cmp, IsConst >::operator!=(const BreadthCursor< Key, Value, Cmp, IsConst > & oth) const noexcept
+    {
+      return !(*this == oth);
+    }
+
+    template< typename Key, typename Value, typename Cmp, bool IsConst >
+    void BreadthCursor< Key, Value, Cmp, IsConst >::pushChildren()
+    {
+      if (node_->left)
+      {
+        buffer_->push(node_->left);
+      }
+      if (node_->right)
+      {
+        buffer_->push(node_->right);
+      }
+    }
+  }
+}
+#endif
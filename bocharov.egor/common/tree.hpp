@@ -1,5 +1,6 @@
 #ifndef TREE_HPP
 #define TREE_HPP
+#include <algorithm>
 #include <cstddef>
 #include <functional>
 #include <stdexcept>
@@ -9,6 +10,7 @@
 #include "cIterator.hpp"
 
 #include "breadthIterator.hpp"
+#include "breadthCursor.hpp"
 #include "lnrIterator.hpp"
 #include "rnlIterator.hpp"
 
@@ -30,6 +32,9 @@ namespace bocharov
     using ConstRnlIterator = detail::RnlIterator< Key, T, Cmp, true >;
     using BreadthIterator = detail::BreadthIterator< Key, T, Cmp, false >;
     using ConstBreadthIterator = detail::BreadthIterator< Key, T, Cmp, true >;
+    using BreadthCursor = detail::BreadthCursor< Key, T, Cmp, false >;
+    using ConstBreadthCursor = detail::BreadthCursor< Key, T, Cmp, true >;
+    using BreadthBuffer = detail::BreadthBuffer< TreeNode< Key, T > >;
 
     Tree();
     Tree(const Tree< Key, T, Cmp > &);
@@ -80,6 +85,10 @@ namespace bocharov
     ConstBreadthIterator breadthCbegin() const noexcept;
     BreadthIterator breadthEnd() noexcept;
     ConstBreadthIterator breadthCend() const noexcept;
+    BreadthCursor breadthBegin(BreadthBuffer &);
+    ConstBreadthCursor breadthCbegin(BreadthBuffer &) const;
+    BreadthCursor breadthEnd(BreadthBuffer &) noexcept;
+    ConstBreadthCursor breadthCend(BreadthBuffer &) const noexcept;
 
     template< typename F >
     F traverse_lnr(F f) const;
@@ -125,6 +134,7 @@ namespace bocharov
     int getBalanceFactor(Node *) const noexcept;
     void updateHeight(Node *) noexcept;
     void clearTree(Node *) noexcept;
+    size_t breadthCapacity() const noexcept;
   };
 
   template< typename Key, typename T, typename Cmp >
@@ -887,6 +897,47 @@ namespace bocharov
     return ConstBreadthIterator(nullptr);
   }
 
+  template< typename Key, typename T, typename Cmp >
+  typename Tree< Key, T, Cmp >::BreadthCursor Tree< Key, T, Cmp >::breadthBegin(BreadthBuffer & buffer)
+  {
+    buffer.reset(breadthCapacity());
+    return BreadthCursor(empty() ? nullptr : root_, std::addressof(buffer));
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename Tree< Key, T, Cmp >::ConstBreadthCursor Tree< Key, T, Cmp >::breadthCbegin(BreadthBuffer & buffer) const
+  {
+    buffer.reset(breadthCapacity());
+    return ConstBreadthCursor(empty() ? nullptr : root_, std::addressof(buffer));
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename Tree< Key, T, Cmp >::BreadthCursor Tree< Key, T, Cmp >::breadthEnd(BreadthBuffer & buffer) noexcept
+  {
+    return BreadthCursor(nullptr, std::addressof(buffer));
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  typename Tree< Key, T, Cmp >::ConstBreadthCursor Tree< Key, T, Cmp >::breadthCend(BreadthBuffer & buffer) const noexcept
+  {
+    return ConstBreadthCursor(nullptr, std::addressof(buffer));
+  }
+
+  template< typename Key, typename T, typename Cmp >
+  size_t Tree< Key, T, Cmp >::breadthCapacity() const noexcept
+  {
+    if (empty())
+    {
+      return 0;
+    }
+    const size_t levels = static_cast< size_t >(root_->height) + 1;
+    if (levels >= sizeof(size_t) * 8 - 1)
+    {
+      return size_;
+    }
+    return std::min(size_, size_t(1) << levels);
+  }
+
   template< typename Key, typename T, typename Cmp >
   template< typename F >
   F Tree< Key, T, Cmp >::traverse_lnr(F f) const
@@ -913,7 +964,8 @@ namespace bocharov
   template< typename F >
   F Tree< Key, T, Cmp >::traverse_breadth(F f) const
   {
-    for (ConstBreadthIterator it = breadthCbegin(); it != breadthCend(); ++it)
+    BreadthBuffer buffer;
+    for (ConstBreadthCursor it = breadthCbegin(buffer); it != breadthCend(buffer); ++it)
     {
       f(*(it));
     }
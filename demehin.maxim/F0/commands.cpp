@@ -1,8 +1,72 @@
 #include "commands.hpp"
 #include <fstream>
+#include <memory>
+#include <dynamic_array.hpp>
 
 namespace
 {
+  struct MergeHead
+  {
+    demehin::tree_t::cIter current;
+    demehin::tree_t::cIter end;
+  };
+
+  struct WordCount
+  {
+    size_t count;
+    const std::string* word;
+  };
+
+  bool isLaterHead(const MergeHead& lhs, const MergeHead& rhs)
+  {
+    return rhs.current->first < lhs.current->first;
+  }
+
+  bool isMoreCommon(const WordCount& lhs, const WordCount& rhs)
+  {
+    return lhs.count > rhs.count || (lhs.count == rhs.count && *lhs.word < *rhs.word);
+  }
+
+  template< typename T, typename Cmp >
+  void siftDown(demehin::DynamicArray< T >& heap, size_t i, Cmp cmp)
+  {
+    size_t size = heap.size();
+    while (2 * i + 1 < size)
+    {
+      size_t child = 2 * i + 1;
+      if (child + 1 < size && cmp(heap[child], heap[child + 1]))
+      {
+        child++;
+      }
+      if (!cmp(heap[i], heap[child]))
+      {
+        break;
+      }
+      std::swap(heap[i], heap[child]);
+      i = child;
+    }
+  }
+
+  template< typename T, typename Cmp >
+  void pushHeap(demehin::DynamicArray< T >& heap, const T& value, Cmp cmp)
+  {
+    heap.push(value);
+    size_t i = heap.size() - 1;
+    while (i > 0 && cmp(heap[(i - 1) / 2], heap[i]))
+    {
+      std::swap(heap[(i - 1) / 2], heap[i]);
+      i = (i - 1) / 2;
+    }
+  }
+
+  template< typename T, typename Cmp >
+  void popHeap(demehin::DynamicArray< T >& heap, Cmp cmp)
+  {
+    std::swap(heap[0], heap[heap.size() - 1]);
+    heap.pop_back();
+    siftDown(heap, 0, cmp);
+  }
+
   void printList(std::ostream& out, const demehin::list_t& lst)
   {
     bool isFirst = true;
@@ -348,36 +412,50 @@ void demehin::printMostCommons(std::istream& in, std::ostream& out, const dict_t
     dicts_names.push_back(dict_name);
   }
 
-  Tree< std::string, int > word_frequency;
+  DynamicArray< MergeHead > heads;
   for (auto&& name: dicts_names)
   {
-    auto unit = dicts.at(name);
-    for (auto&& key: unit)
+    const tree_t& dict = dicts.at(name);
+    if (!dict.empty())
     {
-      word_frequency[key.first]++;
+      pushHeap(heads, MergeHead{ dict.cbegin(), dict.cend() }, isLaterHead);
     }
   }
 
-  Tree< int, list_t, std::greater< int > > freq_to_words;
-  for (auto&& key: word_frequency)
-  {
-    freq_to_words[key.second].push_back(key.first);
-  }
-
-  int cnt = 0;
-  for (auto&& key: freq_to_words)
+  DynamicArray< WordCount > most_commons;
+  while (!heads.empty())
   {
-    for (auto&& word: key.second)
+    WordCount word_count{ 0, std::addressof(heads[0].current->first) };
+    while (!heads.empty() && heads[0].current->first == *word_count.word)
     {
-      if (cnt++ >= n)
+      MergeHead head = heads[0];
+      popHeap(heads, isLaterHead);
+      if (++head.current != head.end)
       {
-        break;
+        pushHeap(heads, head, isLaterHead);
       }
-      out << word << " " << key.first << "\n";
+      word_count.count++;
+    }
+
+    if (most_commons.size() < static_cast< size_t >(n))
+    {
+      pushHeap(most_commons, word_count, isMoreCommon);
     }
-    if (cnt >= n)
+    else if (isMoreCommon(word_count, most_commons[0]))
     {
-      break;
+      most_commons[0] = word_count;
+      siftDown(most_commons, 0, isMoreCommon);
     }
   }
+
+  DynamicArray< WordCount > ordered;
+  while (!most_commons.empty())
+  {
+    ordered.push(most_commons[0]);
+    popHeap(most_commons, isMoreCommon);
+  }
+  for (size_t i = ordered.size(); i > 0; i--)
+  {
+    out << *ordered[i - 1].word << " " << ordered[i - 1].count << "\n";
+  }
 }
@@ -0,0 +1,187 @@
+#include "byteHistogram.hpp"
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <system_error>
+#include <thread>
+
+namespace
+{
+  using duhanina::ByteHistogram;
+  using duhanina::str_t;
+
+  const size_t CHUNK_SIZE = 1 << 16;
+  const size_t MIN_PART_SIZE = 1 << 24;
+
+  void count_bytes(const char* data, size_t size, ByteHistogram& hist)
+  {
+    for (size_t i = 0; i < size; i++)
+    {
+      ++hist.counts[static_cast< unsigned char >(data[i])];
+    }
+    hist.total += size;
+  }
+
+  void count_stream(std::istream& in, size_t limit, ByteHistogram& hist)
+  {
+    std::unique_ptr< char[] > buffer(new char[CHUNK_SIZE]);
+    while (limit > 0 && in)
+    {
+      in.read(buffer.get(), std::min(CHUNK_SIZE, limit));
+      size_t got = static_cast< size_t >(in.gcount());
+      count_bytes(buffer.get(), got, hist);
+      limit -= got;
+    }
+  }
+
+  void count_range(str_t filename, size_t begin, size_t size, ByteHistogram& hist)
+  {
+    std::ifstream in(filename, std::ios::binary);
+    if (!in || !in.seekg(begin))
+    {
+      throw std::runtime_error("FILE_NOT_FOUND");
+    }
+    count_stream(in, size, hist);
+  }
+
+  void merge_histogram(ByteHistogram& to, const ByteHistogram& from)
+  {
+    for (size_t i = 0; i < 256; i++)
+    {
+      to.counts[i] += from.counts[i];
+    }
+    to.total += from.total;
+  }
+
+  size_t get_stream_size(std::istream& in)
+  {
+    in.seekg(0, std::ios::end);
+    std::streamoff size = in.tellg();
+    in.seekg(0, std::ios::beg);
+    if (size < 0 || !in)
+    {
+      in.clear();
+      in.seekg(0, std::ios::beg);
+      return 0;
+    }
+    return static_cast< size_t >(size);
+  }
+}
+
+duhanina::ByteHistogram duhanina::build_histogram(str_t filename)
+{
+  std::ifstream in(filename, std::ios::binary);
+  if (!in)
+  {
+    throw std::runtime_error("FILE_NOT_FOUND");
+  }
+  ByteHistogram hist;
+  size_t size = get_stream_size(in);
+  size_t parts = std::min< size_t >(std::thread::hardware_concurrency(), size / MIN_PART_SIZE);
+  if (parts < 2)
+  {
+    count_stream(in, std::numeric_limits< size_t >::max(), hist);
+    return hist;
+  }
+  in.close();
+
+  std::unique_ptr< ByteHistogram[] > partials(new ByteHistogram[parts]);
+  std::unique_ptr< std::exception_ptr[] > errors(new std::exception_ptr[parts]);
+  size_t step = size / parts;
+  auto work = [&](size_t i)
+  {
+    try
+    {
+      size_t begin = i * step;
+      count_range(filename, begin, i + 1 == parts ? size - begin : step, partials[i]);
+    }
+    catch (...)
+    {
+      errors[i] = std::current_exception();
+    }
+  };
+  std::unique_ptr< std::thread[] > workers(new std::thread[parts - 1]);
+  size_t started = 0;
+  try
+  {
+    for (; started < parts - 1; started++)
+    {
+      workers[started] = std::thread(work, started + 1);
+    }
+  }
+  catch (const std::system_error&)
+  {}
+  work(0);
+  for (size_t i = started + 1; i < parts; i++)
+  {
+    work(i);
+  }
+  for (size_t i = 0; i < started; i++)
+  {
+    workers[i].join();
+  }
+  for (size_t i = 0; i < parts; i++)
+  {
+    if (errors[i])
+    {
+      std::rethrow_exception(errors[i]);
+    }
+    merge_histogram(hist, partials[i]);
+  }
+  return hist;
+}
+
+bool duhanina::build_histograms(str_t file1, str_t file2, ByteHistogram& hist1, ByteHistogram& hist2)
+{
+  std::ifstream in1(file1, std::ios::binary);
+  std::ifstream in2(file2, std::ios::binary);
+  if (!in1 || !in2)
+  {
+    throw std::runtime_error("FILE_NOT_FOUND");
+  }
+  std::unique_ptr< char[] > buffer1(new char[CHUNK_SIZE]);
+  std::unique_ptr< char[] > buffer2(new char[CHUNK_SIZE]);
+  bool identical = true;
+  while (in1 || in2)
+  {
+    in1.read(buffer1.get(), CHUNK_SIZE);
+    in2.read(buffer2.get(), CHUNK_SIZE);
+    size_t got1 = static_cast< size_t >(in1.gcount());
+    size_t got2 = static_cast< size_t >(in2.gcount());
+    count_bytes(buffer1.get(), got1, hist1);
+    count_bytes(buffer2.get(), got2, hist2);
+    identical = identical && got1 == got2 && std::equal(buffer1.get(), buffer1.get() + got1, buffer2.get());
+  }
+  return identical;
+}
+
+duhanina::EncodingScore duhanina::score_encoding(const ByteHistogram& hist, const CodeTable& table)
+{
+  EncodingScore score;
+  for (size_t i = 0; i < 256; i++)
+  {
+    if (hist.counts[i] == 0)
+    {
+      continue;
+    }
+    auto it = table.char_to_code.find(static_cast< char >(i));
+    if (it == table.char_to_code.cend())
+    {
+      ++score.missing_symbols;
+      score.missing_chars += hist.counts[i];
+    }
+    else
+    {
+      score.encoded_bits += hist.counts[i] * it->second.size();
+    }
+  }
+  return score;
+}
+
+double duhanina::get_compressed_size(const EncodingScore& score)
+{
+  return std::ceil(score.encoded_bits / 8.0) + sizeof(size_t);
+}
@@ -0,0 +1,28 @@
+#ifndef BYTEHISTOGRAM_HPP
+#define BYTEHISTOGRAM_HPP
+
+#include <string>
+#include "shannonFano.hpp"
+
+namespace duhanina
+{
+  struct ByteHistogram
+  {
+    size_t counts[256] = {};
+    size_t total = 0;
+  };
+
+  struct EncodingScore
+  {
+    size_t encoded_bits = 0;
+    size_t missing_symbols = 0;
+    size_t missing_chars = 0;
+  };
+
+  ByteHistogram build_histogram(str_t filename);
+  bool build_histograms(str_t file1, str_t file2, ByteHistogram& hist1, ByteHistogram& hist2);
+  EncodingScore score_encoding(const ByteHistogram& hist, const CodeTable& table);
+  double get_compressed_size(const EncodingScore& score);
+}
+
+#endif
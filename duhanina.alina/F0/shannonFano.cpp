@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <list.hpp>
 #include <array.hpp>
+#include "byteHistogram.hpp"
 
 namespace
 {
@@ -414,6 +415,19 @@ namespace
     }
     out << "\n";
   }
+
+  bool is_better_score(const duhanina::EncodingScore& lhs, const duhanina::EncodingScore& rhs)
+  {
+    if (lhs.missing_chars != rhs.missing_chars)
+    {
+      return lhs.missing_chars < rhs.missing_chars;
+    }
+    if (lhs.missing_symbols != rhs.missing_symbols)
+    {
+      return lhs.missing_symbols < rhs.missing_symbols;
+    }
+    return lhs.encoded_bits < rhs.encoded_bits;
+  }
 }
 
 void duhanina::build_codes(str_t input_file, str_t encoding_id, std::ostream& out)
@@ -555,34 +569,23 @@ void duhanina::compare(str_t file1, str_t file2, str_t encod_id1, str_t encod_id
   {
     throw std::runtime_error("NO_SUCH_ID");
   }
-  std::ifstream in1(file1), in2(file2);
-  if (!in1 || !in2)
-  {
-    throw std::runtime_error("FILE_NOT_FOUND");
-  }
-  std::string text1;
-  char ch1;
-  while (in1.get(ch1))
+  ByteHistogram hist1;
+  ByteHistogram hist2;
+  if (build_histograms(file1, file2, hist1, hist2))
   {
-    text1 += ch1;
+    throw std::runtime_error("IDENTICAL_TEXTS");
   }
-  std::string text2;
-  char ch2;
-  while (in2.get(ch2))
+  EncodingScore score1 = score_encoding(hist1, it1->second);
+  EncodingScore score2 = score_encoding(hist2, it2->second);
+  if (score1.missing_chars != 0 || score2.missing_chars != 0)
   {
-    text2 += ch2;
+    throw std::runtime_error("INVALID_CODES");
   }
-  if (text1 == text2)
-  {
-    throw std::runtime_error("IDENTICAL_TEXTS");
-  }
-  std::string encoded1 = encode_text(text1, it1->second);
-  std::string encoded2 = encode_text(text2, it2->second);
-  double size1_orig = text1.size();
-  double size1_comp = std::ceil(encoded1.size() / 8.0) + sizeof(size_t);
+  double size1_orig = hist1.total;
+  double size1_comp = get_compressed_size(score1);
   double ratio1 = size1_comp / size1_orig;
-  double size2_orig = text2.size();
-  double size2_comp = std::ceil(encoded2.size() / 8.0) + sizeof(size_t);
+  double size2_orig = hist2.total;
+  double size2_comp = get_compressed_size(score2);
   double ratio2 = size2_comp / size2_orig;
   out << "Compression efficiency comparison:\n";
   out << "----------------------------------------\n";
@@ -628,7 +631,7 @@ void duhanina::print_help(std::ostream& out)
   out << "compare <file1> <file2> <encoding_id1> <encoding_id2> - compare efficiency\n";
   out << "list_encodings - list all encodings\n";
   out << "check_encoding <input_file> <encoding_id> - verify if encoding supports all file characters\n";
-  out << "suggest_encodings <input_file> - show which encodings best support the file\n";
+  out << "suggest_encodings <input_file> - show which encodings best support the file, best first\n";
   out << "--help - show this help\n";
 }
 
@@ -639,6 +642,12 @@ void duhanina::check_encoding(str_t input_file, str_t encoding_id, std::ostream&
   {
     throw std::runtime_error("Encoding '" + encoding_id + "' not found");
   }
+  ByteHistogram hist = build_histogram(input_file);
+  if (score_encoding(hist, it->second).missing_chars == 0)
+  {
+    out << "Encoding fully supports the file\n";
+    return;
+  }
   std::ifstream in(input_file);
   if (!in)
   {
@@ -650,38 +659,27 @@ void duhanina::check_encoding(str_t input_file, str_t encoding_id, std::ostream&
   {
     text += ch;
   }
-  auto missing = find_missing_chars(text, it->second.char_to_code);
-  if (missing.empty())
-  {
-    out << "Encoding fully supports the file\n";
-  }
-  else
-  {
-    out << "Encoding issues in '" << encoding_id << "':\n";
-    print_missing_chars(missing, out);
-  }
+  out << "Encoding issues in '" << encoding_id << "':\n";
+  print_missing_chars(find_missing_chars(text, it->second.char_to_code), out);
 }
 
 void duhanina::suggest_encodings(str_t input_file, std::ostream& out)
 {
-  std::ifstream in(input_file);
-  if (!in)
-  {
-    throw std::runtime_error("FILE_NOT_FOUND");
-  }
-  std::string text;
-  char ch;
-  while (in.get(ch))
+  ByteHistogram hist = build_histogram(input_file);
+  DynamicArray< std::pair< std::string, EncodingScore > > ranked;
+  for (auto encoding_it = encoding_store.begin(); encoding_it != encoding_store.end(); ++encoding_it)
   {
-    text += ch;
+    ranked.push_back(std::make_pair(encoding_it->first, score_encoding(hist, encoding_it->second)));
+    for (size_t i = ranked.size() - 1; i > 0 && is_better_score(ranked[i].second, ranked[i - 1].second); i--)
+    {
+      std::swap(ranked[i], ranked[i - 1]);
+    }
   }
   out << "Encoding compatibility report:\n";
-  for (auto encoding_it = encoding_store.begin(); encoding_it != encoding_store.end(); ++encoding_it)
+  for (size_t i = 0; i < ranked.size(); i++)
   {
-    str_t id = encoding_it->first;
-    const CodeTable& table = encoding_it->second;
-    duhanina::List< char > missing = find_missing_chars(text, table.char_to_code);
-    if (missing.empty())
+    str_t id = ranked[i].first;
+    if (ranked[i].second.missing_chars == 0)
     {
       out << " - " << id << ": " << "FULL" << " support\n";
     }
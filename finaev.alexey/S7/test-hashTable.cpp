@@ -63,3 +63,78 @@ BOOST_AUTO_TEST_CASE(rehash_test)
   table.rehash(old_size * 2);
   BOOST_TEST(table.size() == old_size);
 }
+
+BOOST_AUTO_TEST_CASE(incremental_growth_test)
+{
+  finaev::HashTable< int, int > table;
+  for (int i = 0; i < 1000; ++i)
+  {
+    BOOST_TEST(table.insert(std::make_pair(i, i * 2)).second);
+    BOOST_TEST(table.find(i / 2)->second == i / 2 * 2);
+  }
+  BOOST_TEST(table.size() == 1000);
+  size_t count = 0;
+  long long sum = 0;
+  for (auto it = table.cbegin(); it != table.cend(); ++it)
+  {
+    ++count;
+    sum += it->first;
+  }
+  BOOST_TEST(count == 1000);
+  BOOST_TEST(sum == 999 * 1000 / 2);
+  BOOST_TEST(!table.insert(std::make_pair(10, 0)).second);
+  BOOST_TEST(table.at(10) == 20);
+}
+
+BOOST_AUTO_TEST_CASE(erase_while_migrating_test)
+{
+  finaev::HashTable< int, std::string > table;
+  for (int i = 0; i < 12; ++i)
+  {
+    table[i] = std::to_string(i);
+  }
+  table[12] = "12";
+  BOOST_TEST(table.erase(11) == 1);
+  BOOST_TEST(table.erase(11) == 0);
+  for (int i = 0; i < 11; ++i)
+  {
+    BOOST_TEST(table.at(i) == std::to_string(i));
+  }
+  BOOST_TEST((table.find(11) == table.end()));
+  BOOST_TEST(table.size() == 12);
+}
+
+BOOST_AUTO_TEST_CASE(tombstones_test)
+{
+  finaev::HashTable< int, int > table;
+  for (int i = 0; i < 10000; ++i)
+  {
+    table[i] = i;
+    BOOST_TEST(table.erase(i) == 1);
+  }
+  BOOST_TEST(table.empty());
+  BOOST_TEST((table.begin() == table.end()));
+  table[5] = 5;
+  BOOST_TEST(table.at(5) == 5);
+}
+
+BOOST_AUTO_TEST_CASE(collisions_test)
+{
+  struct SameHash
+  {
+    size_t operator()(int) const
+    {
+      return 7;
+    }
+  };
+  finaev::HashTable< int, int, SameHash > table;
+  for (int i = 0; i < 40; ++i)
+  {
+    table.insert(std::make_pair(i, -i));
+  }
+  table.erase(3);
+  for (int i = 0; i < 40; ++i)
+  {
+    BOOST_TEST((table.find(i) == table.end()) == (i == 3));
+  }
+}
@@ -42,20 +42,35 @@ namespace finaev
 
     void rehash(size_t n);
   private:
-    DynamicArr< Slot< Key, Value > > table_;
+    using table_t = DynamicArr< Slot< Key, Value > >;
+    static constexpr size_t migration_step_ = 16;
+
+    table_t table_;
+    table_t old_;
+    size_t migrated_;
     size_t size_;
+    size_t deleted_;
     Hash hasher_;
     Equal equal_;
     float max_load_factor_ = 0.7;
 
+    size_t slotCount() const noexcept;
+    Slot< Key, Value >& slotAt(size_t i);
+    const Slot< Key, Value >& slotAt(size_t i) const;
     size_t findIndex(const Key & k) const;
-    size_t findIndexIn(const Key & k, const DynamicArr< Slot< Key, Value > >& table) const;
+    size_t findIndexIn(const Key & k, const table_t& table) const;
+    size_t findFreeIn(const Key & k, const table_t& table) const;
+    void startMigration(size_t n);
+    void migrate(size_t count);
   };
 
   template< class Key, class Value, class Hash, class Equal >
   HashTable< Key, Value, Hash, Equal >::HashTable():
     table_(16),
-    size_(0)
+    old_(0),
+    migrated_(0),
+    size_(0),
+    deleted_(0)
   {}
 
   template< class Key, class Value, class Hash, class Equal >
@@ -73,8 +88,11 @@ namespace finaev
   template< class Key, class Value, class Hash, class Equal >
   void HashTable< Key, Value, Hash, Equal >::swap(HashTable< Key, Value, Hash, Equal >& rhs) noexcept
   {
-    std::swap(table_, rhs.table_);
+    table_.swap(rhs.table_);
+    old_.swap(rhs.old_);
+    std::swap(migrated_, rhs.migrated_);
     std::swap(size_, rhs.size_);
+    std::swap(deleted_, rhs.deleted_);
     std::swap(hasher_, rhs.hasher_);
     std::swap(equal_, rhs.equal_);
     std::swap(max_load_factor_, rhs.max_load_factor_);
@@ -89,7 +107,7 @@ namespace finaev
   template< class Key, class Value, class Hash, class Equal >
   typename HashTable< Key, Value, Hash, Equal >::Iter HashTable< Key, Value, Hash, Equal >::end()
   {
-    return Iter{this, table_.size()};
+    return Iter{this, slotCount()};
   }
 
   template< class Key, class Value, class Hash, class Equal >
@@ -101,33 +119,70 @@ namespace finaev
   template< class Key, class Value, class Hash, class Equal >
   typename HashTable< Key, Value, Hash, Equal >::constIter HashTable< Key, Value, Hash, Equal >::cend() const
   {
-    return constIter{this, table_.size()};
+    return constIter{this, slotCount()};
+  }
+
+  template< class Key, class Value, class Hash, class Equal >
+  size_t HashTable< Key, Value, Hash, Equal >::slotCount() const noexcept
+  {
+    return table_.size() + old_.size();
+  }
+
+  template< class Key, class Value, class Hash, class Equal >
+  Slot< Key, Value >& HashTable< Key, Value, Hash, Equal >::slotAt(size_t i)
+  {
+    return i < table_.size() ? table_[i] : old_[i - table_.size()];
+  }
+
+  template< class Key, class Value, class Hash, class Equal >
+  const Slot< Key, Value >& HashTable< Key, Value, Hash, Equal >::slotAt(size_t i) const
+  {
+    return i < table_.size() ? table_[i] : old_[i - table_.size()];
   }
 
   template< class Key, class Value, class Hash, class Equal >
   size_t HashTable< Key, Value, Hash, Equal >::findIndex(const Key & k) const
   {
-    size_t baseSlot = hasher_(k) % table_.size();
+    size_t index = findIndexIn(k, table_);
+    if (index != table_.size())
+    {
+      return index;
+    }
+    if (old_.size() != 0)
+    {
+      index = findIndexIn(k, old_);
+      if (index != old_.size())
+      {
+        return table_.size() + index;
+      }
+    }
+    return slotCount();
+  }
+
+  template< class Key, class Value, class Hash, class Equal >
+  size_t HashTable< Key, Value, Hash, Equal >::findIndexIn(const Key& k, const table_t& table) const
+  {
+    size_t baseSlot = hasher_(k) % table.size();
     size_t currSlot = baseSlot;
     size_t i = 1;
-    while (i <= table_.size())
+    while (i <= table.size())
     {
-      if (table_[currSlot].occupied && equal_(table_[currSlot].data.first, k))
+      if (table[currSlot].occupied && equal_(table[currSlot].data.first, k))
       {
         return currSlot;
       }
-      if (!table_[currSlot].occupied && !table_[currSlot].deleted)
+      if (!table[currSlot].occupied && !table[currSlot].deleted)
       {
         break;
       }
-      currSlot = (baseSlot + i) % table_.size();
+      currSlot = (baseSlot + i) % table.size();
       ++i;
     }
-    return table_.size();
+    return table.size();
   }
 
   template< class Key, class Value, class Hash, class Equal >
-  size_t HashTable< Key, Value, Hash, Equal >::findIndexIn(const Key& k, const DynamicArr< Slot< Key, Value > >& table) const
+  size_t HashTable< Key, Value, Hash, Equal >::findFreeIn(const Key& k, const table_t& table) const
   {
     size_t baseSlot = hasher_(k) % table.size();
     size_t currSlot = baseSlot;
@@ -140,25 +195,54 @@ namespace finaev
     return currSlot;
   }
 
+  template< class Key, class Value, class Hash, class Equal >
+  void HashTable< Key, Value, Hash, Equal >::startMigration(size_t n)
+  {
+    migrate(old_.size());
+    table_t temp(n);
+    table_.swap(temp);
+    old_.swap(temp);
+    migrated_ = 0;
+    deleted_ = 0;
+  }
+
+  template< class Key, class Value, class Hash, class Equal >
+  void HashTable< Key, Value, Hash, Equal >::migrate(size_t count)
+  {
+    for (; count > 0 && migrated_ < old_.size(); --count, ++migrated_)
+    {
+      Slot< Key, Value >& slot = old_[migrated_];
+      if (slot.occupied)
+      {
+        size_t newId = findFreeIn(slot.data.first, table_);
+        if (table_[newId].deleted)
+        {
+          --deleted_;
+        }
+        table_[newId].data = std::move(slot.data);
+        table_[newId].occupied = true;
+        table_[newId].deleted = false;
+        slot.occupied = false;
+        slot.deleted = true;
+      }
+    }
+    if (migrated_ == old_.size())
+    {
+      table_t(0).swap(old_);
+      migrated_ = 0;
+    }
+  }
+
   template< class Key, class Value, class Hash, class Equal >
   void HashTable< Key, Value, Hash, Equal >::rehash(size_t n)
   {
+    migrate(old_.size());
     if (n < table_.size())
     {
       return;
     }
-    DynamicArr< Slot< Key, Value > > temp(n);
-    for (size_t i = 0; i < table_.size(); ++i)
-    {
-      if (table_[i].occupied)
-      {
-        size_t newId = findIndexIn(table_[i].data.first, temp);
-        temp[newId].data = table_[i].data;
-        temp[newId].occupied = true;
-        temp[newId].deleted = false;
-      }
-    }
-    table_.swap(temp);
+    startMigration(n);
+    migrate(old_.size());
   }
 
   template< class Key, class Value, class Hash, class Equal >
@@ -218,22 +302,24 @@ namespace finaev
   size_t HashTable< Key, Value, Hash, Equal >::erase(const Key& key) noexcept
   {
     size_t index = findIndex(key);
-    if (index == table_.size())
+    if (index == slotCount())
     {
       return 0;
     }
-    table_[index].occupied = false;
-    table_[index].deleted = true;
-    --size_;
+    erase(Iter{this, index});
     return 1;
   }
 
   template< class Key, class Value, class Hash, class Equal >
   typename HashTable< Key, Value, Hash, Equal >::Iter HashTable< Key, Value, Hash, Equal >::erase(Iter it) noexcept
   {
-    size_t slot = it.index_;
-    table_[slot].occupied = false;
-    table_[slot].deleted = true;
+    Slot< Key, Value >& slot = slotAt(it.index_);
+    slot.occupied = false;
+    slot.deleted = true;
+    if (it.index_ < table_.size())
+    {
+      ++deleted_;
+    }
     --size_;
     return Iter{this, it.index_ + 1};
   }
@@ -246,34 +332,21 @@ namespace finaev
     {
       rehash(16);
     }
-    if (size_ >= table_.size() * max_load_factor_)
+    migrate(migration_step_);
+    size_t index = findIndex(val.first);
+    if (index != slotCount())
     {
-      rehash(table_.size() * 2);
+      return std::make_pair(Iter(this, index), false);
     }
-    size_t baseSlot = hasher_(val.first) % table_.size();
-    size_t currSlot = baseSlot;
-    size_t i = 1;
-    size_t firstDeleted = table_.size();
-    while (i <= table_.size())
+    if (size_ + deleted_ + 1 > table_.size() * max_load_factor_)
     {
-      if (table_[currSlot].occupied && equal_(table_[currSlot].data.first, val.first))
-      {
-        return std::make_pair(Iter(this, currSlot), false);
-      }
-      if (!table_[currSlot].occupied && table_[currSlot].deleted && firstDeleted == table_.size())
-      {
-        firstDeleted = currSlot;
-      }
-      if (!table_[currSlot].occupied && !table_[currSlot].deleted)
-      {
-        break;
-      }
-      currSlot = (baseSlot + i * i) % table_.size();
-      ++i;
+      startMigration(size_ + 1 > table_.size() * max_load_factor_ / 2 ? table_.size() * 2 : table_.size());
+      migrate(migration_step_);
     }
-    if (i > table_.size() && firstDeleted != table_.size())
+    size_t currSlot = findFreeIn(val.first, table_);
+    if (table_[currSlot].deleted)
     {
-      currSlot = firstDeleted;
+      --deleted_;
     }
     table_[currSlot].data = val;
     table_[currSlot].occupied = true;
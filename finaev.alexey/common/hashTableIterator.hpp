@@ -40,7 +40,7 @@ namespace finaev
   template< class Key, class Value, class Hash, class Equal >
   void HashTableIterator< Key, Value, Hash, Equal >::skipEmpty()
   {
-    while (index_ < table_->table_.size() && (!table_->table_[index_].occupied || table_->table_[index_].deleted))
+    while (index_ < table_->slotCount() && (!table_->slotAt(index_).occupied || table_->slotAt(index_).deleted))
     {
       ++index_;
     }
@@ -95,13 +95,13 @@ namespace finaev
   template< class Key, class Value, class Hash, class Equal >
   std::pair< Key, Value >& HashTableIterator< Key, Value, Hash, Equal >::operator*()
   {
-    return table_->table_[index_].data;
+    return table_->slotAt(index_).data;
   }
 
   template< class Key, class Value, class Hash, class Equal >
   std::pair< Key, Value >* HashTableIterator< Key, Value, Hash, Equal >::operator->()
   {
-    return std::addressof(table_->table_[index_].data);
+    return std::addressof(table_->slotAt(index_).data);
   }
 
   template< class Key, class Value, class Hash, class Equal >
@@ -40,7 +40,7 @@ namespace finaev
   template< class Key, class Value, class Hash, class Equal >
   void HashTableConstIterator< Key, Value, Hash, Equal >::skipEmpty()
   {
-    while (index_ < table_->table_.size() && (!table_->table_[index_].occupied || table_->table_[index_].deleted))
+    while (index_ < table_->slotCount() && (!table_->slotAt(index_).occupied || table_->slotAt(index_).deleted))
     {
       ++index_;
     }
@@ -95,13 +95,13 @@ namespace finaev
   template< class Key, class Value, class Hash, class Equal >
   const std::pair< Key, Value >& HashTableConstIterator< Key, Value, Hash, Equal >::operator*() const
   {
-    return table_->table_[index_].data;
+    return table_->slotAt(index_).data;
   }
 
   template< class Key, class Value, class Hash, class Equal >
   const std::pair< Key, Value >* HashTableConstIterator< Key, Value, Hash, Equal >::operator->() const
   {
-    return std::addressof(table_->table_[index_].data);
+    return std::addressof(table_->slotAt(index_).data);
   }
 
   template< class Key, class Value, class Hash, class Equal >
@@ -49,6 +49,7 @@ gavrilova::CommandProcessor::CommandProcessor(StudentDatabase& db):
   commandMap_.insert({"clear", std::bind(&CommandProcessor::handleClear, this)});
   commandMap_.insert({"create_group", std::bind(&CommandProcessor::handleCreateGroup, this)});
   commandMap_.insert({"save", std::bind(&CommandProcessor::handleSave, this)});
+  commandMap_.insert({"savebin", std::bind(&CommandProcessor::handleSaveBinary, this)});
   commandMap_.insert({"loadbase", std::bind(&CommandProcessor::handleLoad, this)});
 }
 
@@ -96,6 +97,7 @@ void gavrilova::CommandProcessor::handleHelp()
             << "avgmarkbydate <ДД-ММ-ГГГГ>\n"
             << "create_group <группа>\n"
             << "save <файл>\n"
+            << "savebin <файл>\n"
             << "loadbase <файл>\n"
             << "clear\n";
 }
@@ -437,6 +439,17 @@ void gavrilova::CommandProcessor::handleSave()
   }
 }
 
+void gavrilova::CommandProcessor::handleSaveBinary()
+{
+  std::string filename;
+  std::cin >> filename;
+  if (db_.saveToBinaryFile(filename)) {
+    std::cout << "База данных сохранена в двоичный файл " << filename << '\n';
+  } else {
+    std::cout << "Ошибка сохранения файла.\n";
+  }
+}
+
 void gavrilova::CommandProcessor::handleLoad()
 {
   std::string filename;
@@ -39,6 +39,7 @@ namespace gavrilova {
     void handleClear();
     void handleCreateGroup();
     void handleSave();
+    void handleSaveBinary();
     void handleLoad();
   };
 }
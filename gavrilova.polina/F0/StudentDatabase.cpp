@@ -1,9 +1,16 @@
 
 #include "StudentDatabase.hpp"
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <limits>
 #include <stdexcept>
+#include <ArrayBuffer.hpp>
 
 namespace {
   template < typename T, typename Compare >
@@ -33,8 +40,281 @@ namespace {
     }
     list.swap(sortedList);
   }
+
+  const char binaryMagic[] = "GAVRDB01";
+  const size_t magicSize = 8;
+  const size_t binaryHeaderSize = magicSize + 4 * sizeof(std::uint64_t);
+  const size_t rebuildRatio = 8;
+
+  std::uint32_t packDate(const gavrilova::date::Date& date)
+  {
+    return date.year * 10000 + date.month * 100 + date.day;
+  }
+
+  bool unpackDate(std::uint32_t packed, gavrilova::date::Date& date)
+  {
+    date.year = packed / 10000;
+    date.month = packed / 100 % 100;
+    date.day = packed % 100;
+    return date.month >= 1 && date.month <= 12 && date.day >= 1 && date.day <= 31 &&
+        date.year >= 1900 && date.year <= 2100;
+  }
+
+  // Date input accepts years 1900..2100 only, so every date maps to a dense day index.
+  const size_t dayCount = 201 * 12 * 31;
+
+  size_t dayIndex(const gavrilova::date::Date& date)
+  {
+    return ((date.year - 1900) * 12 + date.month - 1) * 31 + date.day - 1;
+  }
+
+  gavrilova::date::Date dateOfDay(size_t day)
+  {
+    gavrilova::date::Date date{};
+    date.year = day / (12 * 31) + 1900;
+    date.month = day / 31 % 12 + 1;
+    date.day = day % 31 + 1;
+    return date;
+  }
+
+  template < class T >
+  T readAt(const std::string& data, size_t offset)
+  {
+    T value;
+    std::memcpy(std::addressof(value), data.data() + offset, sizeof(T));
+    return value;
+  }
+
+  template < class T >
+  void writeValue(std::ostream& out, T value)
+  {
+    out.write(reinterpret_cast< const char* >(std::addressof(value)), sizeof(T));
+  }
+
+  template < class T >
+  void writeColumn(std::ostream& out, const gavrilova::ArrayBuffer< T >& column)
+  {
+    if (!column.empty()) {
+      out.write(reinterpret_cast< const char* >(std::addressof(column[0])), column.size() * sizeof(T));
+    }
+  }
+
+  double averageOf(const int* first, const int* last)
+  {
+    long long sum = 0;
+    for (const int* it = first; it != last; ++it) {
+      sum += *it;
+    }
+    return static_cast< double >(sum) / (last - first);
+  }
+
+  template < class Tree, class Generator >
+  struct MergeGenerator {
+    using value_type = typename Tree::value_type;
+    typename Tree::Iterator current;
+    typename Tree::Iterator last;
+    Generator& next;
+    size_t remaining;
+    value_type pending;
+    bool hasPending;
+
+    value_type operator()()
+    {
+      if (!hasPending && remaining > 0) {
+        pending = next();
+        hasPending = true;
+        --remaining;
+      }
+      if (current != last && (!hasPending || current->first < pending.first)) {
+        value_type value(std::move(*current));
+        ++current;
+        return value;
+      }
+      hasPending = false;
+      return std::move(pending);
+    }
+  };
+
+  template < class Tree, class Generator >
+  void mergeSorted(Tree& tree, size_t count, Generator next)
+  {
+    if (count == 0) {
+      return;
+    }
+    if (tree.size() / rebuildRatio > count) {
+      for (size_t i = 0; i < count; ++i) {
+        tree.insert(next());
+      }
+      return;
+    }
+    Tree merged;
+    merged.assign_sorted(tree.size() + count, MergeGenerator< Tree, Generator >{tree.begin(), tree.end(), next, count, {}, false});
+    tree.swap(merged);
+  }
 }
 
+struct gavrilova::StudentDatabase::StudentColumns {
+  ArrayBuffer< std::string > names;
+  ArrayBuffer< size_t > groupIndexes;
+  ArrayBuffer< size_t > gradeBegins;
+  ArrayBuffer< date::Date > dates;
+  ArrayBuffer< int > marks;
+  ArrayBuffer< std::string > groupNames;
+  map< std::string, size_t > groupLookup;
+
+  StudentColumns()
+  {
+    gradeBegins.push_back(0);
+  }
+
+  size_t size() const noexcept
+  {
+    return names.size();
+  }
+
+  size_t addGroup(const std::string& group)
+  {
+    auto it = groupLookup.find(group);
+    if (it != groupLookup.end()) {
+      return it->second;
+    }
+    groupLookup.insert({group, groupNames.size()});
+    groupNames.push_back(group);
+    return groupNames.size() - 1;
+  }
+
+  void dropGrades()
+  {
+    while (dates.size() > gradeBegins.back()) {
+      dates.pop_back();
+      marks.pop_back();
+    }
+  }
+
+  size_t addStudent(std::string&& fullName, size_t group)
+  {
+    size_t first = gradeBegins.back();
+    size_t last = dates.size();
+    for (size_t i = first + 1; i < last; ++i) {
+      date::Date date = dates[i];
+      int mark = marks[i];
+      size_t j = i;
+      for (; j > first && date < dates[j - 1]; --j) {
+        dates[j] = dates[j - 1];
+        marks[j] = marks[j - 1];
+      }
+      dates[j] = date;
+      marks[j] = mark;
+    }
+    size_t unique = first;
+    for (size_t i = first; i < last; ++i) {
+      if (unique == first || dates[unique - 1] < dates[i]) {
+        dates[unique] = dates[i];
+        marks[unique] = marks[i];
+        ++unique;
+      }
+    }
+    while (dates.size() > unique) {
+      dates.pop_back();
+      marks.pop_back();
+    }
+    names.push_back(std::move(fullName));
+    groupIndexes.push_back(group);
+    gradeBegins.push_back(unique);
+    return unique - first;
+  }
+
+  bool readText(std::istream& in)
+  {
+    std::istream::sentry sentry(in);
+    if (!sentry) {
+      return false;
+    }
+    std::string fullName;
+    std::string group;
+    in >> std::quoted(fullName) >> group;
+
+    std::string tmp;
+    std::getline(in, tmp);
+    in.ignore(std::numeric_limits< std::streamsize >::max(), '\n');
+
+    size_t n = 0;
+    if (!(in >> tmp >> n)) {
+      return false;
+    }
+    in.ignore(std::numeric_limits< std::streamsize >::max(), '\n');
+
+    for (size_t i = 0; i < n; ++i) {
+      date::Date date{};
+      int mark = 0;
+      if (!(in >> date >> mark)) {
+        dropGrades();
+        return false;
+      }
+      dates.push_back(date);
+      marks.push_back(mark);
+    }
+    if (addStudent(std::move(fullName), addGroup(group)) == n) {
+      in.ignore(std::numeric_limits< std::streamsize >::max(), '\n');
+    }
+    return true;
+  }
+
+  bool readBinary(const std::string& data)
+  {
+    if (data.size() < binaryHeaderSize) {
+      return false;
+    }
+    std::uint64_t groupCount = readAt< std::uint64_t >(data, magicSize);
+    std::uint64_t studentCount = readAt< std::uint64_t >(data, magicSize + sizeof(std::uint64_t));
+    std::uint64_t gradeCount = readAt< std::uint64_t >(data, magicSize + 2 * sizeof(std::uint64_t));
+    std::uint64_t poolSize = readAt< std::uint64_t >(data, magicSize + 3 * sizeof(std::uint64_t));
+    size_t limit = data.size();
+    if (groupCount > limit || studentCount > limit || gradeCount > limit || poolSize > limit) {
+      return false;
+    }
+    const size_t field = sizeof(std::uint32_t);
+    size_t groupsOffset = binaryHeaderSize;
+    size_t namesOffset = groupsOffset + groupCount * field;
+    size_t indexesOffset = namesOffset + studentCount * field;
+    size_t countsOffset = indexesOffset + studentCount * field;
+    size_t datesOffset = countsOffset + studentCount * field;
+    size_t marksOffset = datesOffset + gradeCount * field;
+    size_t pool = marksOffset + gradeCount * field;
+    if (pool > limit || limit - pool != poolSize) {
+      return false;
+    }
+
+    for (size_t i = 0; i < groupCount; ++i) {
+      std::uint32_t length = readAt< std::uint32_t >(data, groupsOffset + i * field);
+      if (length > limit - pool || addGroup(data.substr(pool, length)) != i) {
+        return false;
+      }
+      pool += length;
+    }
+    size_t grade = 0;
+    for (size_t i = 0; i < studentCount; ++i) {
+      std::uint32_t length = readAt< std::uint32_t >(data, namesOffset + i * field);
+      std::uint32_t group = readAt< std::uint32_t >(data, indexesOffset + i * field);
+      std::uint32_t count = readAt< std::uint32_t >(data, countsOffset + i * field);
+      if (length > limit - pool || group >= groupCount || count > gradeCount - grade) {
+        return false;
+      }
+      for (size_t last = grade + count; grade < last; ++grade) {
+        date::Date date{};
+        if (!unpackDate(readAt< std::uint32_t >(data, datesOffset + grade * field), date)) {
+          return false;
+        }
+        dates.push_back(date);
+        marks.push_back(readAt< std::int32_t >(data, marksOffset + grade * field));
+      }
+      addStudent(data.substr(pool, length), group);
+      pool += length;
+    }
+    return grade == gradeCount;
+  }
+};
+
 gavrilova::StudentDatabase::StudentDatabase(int id_digits)
 {
   nextId = static_cast< unsigned long >(std::pow(10, id_digits - 1)) + 1;
@@ -57,30 +337,371 @@ bool gavrilova::StudentDatabase::saveToFile(const std::string& filename) const
   return true;
 }
 
+bool gavrilova::StudentDatabase::saveToBinaryFile(const std::string& filename) const
+{
+  std::ofstream out(filename, std::ios::binary);
+  if (!out) {
+    return false;
+  }
+  map< std::string, std::uint32_t > groupIndexes;
+  ArrayBuffer< std::uint32_t > groupLengths;
+  std::string pool;
+  for (const auto& group: groups) {
+    groupIndexes.insert({group.first, static_cast< std::uint32_t >(groupLengths.size())});
+    groupLengths.push_back(group.first.size());
+    pool += group.first;
+  }
+
+  ArrayBuffer< std::uint32_t > nameLengths;
+  ArrayBuffer< std::uint32_t > studentGroups;
+  ArrayBuffer< std::uint32_t > gradeCounts;
+  ArrayBuffer< std::uint32_t > dates;
+  ArrayBuffer< std::int32_t > marks;
+  for (const auto& student: students) {
+    const student::Student& s = *student.second;
+    nameLengths.push_back(s.fullName_.size());
+    studentGroups.push_back(groupIndexes.at(s.group_));
+    gradeCounts.push_back(s.grades_.size());
+    for (const auto& grade: s.grades_) {
+      dates.push_back(packDate(grade.first));
+      marks.push_back(grade.second);
+    }
+    pool += s.fullName_;
+  }
+
+  out.write(binaryMagic, magicSize);
+  writeValue< std::uint64_t >(out, groupLengths.size());
+  writeValue< std::uint64_t >(out, nameLengths.size());
+  writeValue< std::uint64_t >(out, dates.size());
+  writeValue< std::uint64_t >(out, pool.size());
+  writeColumn(out, groupLengths);
+  writeColumn(out, nameLengths);
+  writeColumn(out, studentGroups);
+  writeColumn(out, gradeCounts);
+  writeColumn(out, dates);
+  writeColumn(out, marks);
+  out.write(pool.data(), pool.size());
+  return static_cast< bool >(out);
+}
+
 bool gavrilova::StudentDatabase::loadFromFile(const std::string& filename)
 {
-  std::ifstream in(filename);
+  std::ifstream in(filename, std::ios::binary);
   if (!in) {
     return false;
   }
-  student::Student temp_student;
-  while (in >> temp_student) {
-    if (!groupExists(temp_student.group_)) {
-      createGroup(temp_student.group_);
-    }
-    auto pair = addStudent(temp_student.fullName_, temp_student.group_);
-    if (pair.first) {
-      auto sp = findStudentById(pair.second);
-      if (sp) {
-        sp->grades_.swap(temp_student.grades_);
-        updateStudentAverageGrade(sp);
-      }
+  StudentColumns columns;
+  char magic[magicSize] = {};
+  if (in.read(magic, magicSize) && std::memcmp(magic, binaryMagic, magicSize) == 0) {
+    std::string data(magic, magicSize);
+    data.append(std::istreambuf_iterator< char >(in), std::istreambuf_iterator< char >());
+    if (!columns.readBinary(data)) {
+      return false;
+    }
+  } else {
+    in.clear();
+    in.seekg(0);
+    while (columns.readText(in)) {
     }
-    temp_student = student::Student();
   }
+  addColumns(columns);
   return true;
 }
 
+void gavrilova::StudentDatabase::addColumns(const StudentColumns& columns)
+{
+  const size_t count = columns.size();
+  const size_t groupCount = columns.groupNames.size();
+
+  ArrayBuffer< size_t > groupOrder;
+  ArrayBuffer< size_t > groupRanks;
+  for (size_t i = 0; i < groupCount; ++i) {
+    groupRanks.push_back(0);
+  }
+  for (const auto& group: columns.groupLookup) {
+    groupRanks[group.second] = groupOrder.size();
+    groupOrder.push_back(group.second);
+  }
+
+  ArrayBuffer< size_t > byName;
+  for (size_t i = 0; i < count; ++i) {
+    byName.push_back(i);
+  }
+  struct NameGroupOrder {
+    const StudentColumns& columns;
+    const ArrayBuffer< size_t >& groupRanks;
+    bool operator()(size_t lhs, size_t rhs) const
+    {
+      int cmp = columns.names[lhs].compare(columns.names[rhs]);
+      if (cmp != 0) {
+        return cmp < 0;
+      }
+      size_t lhsRank = groupRanks[columns.groupIndexes[lhs]];
+      size_t rhsRank = groupRanks[columns.groupIndexes[rhs]];
+      return lhsRank != rhsRank ? lhsRank < rhsRank : lhs < rhs;
+    }
+  };
+  if (count > 1) {
+    std::sort(std::addressof(byName[0]), std::addressof(byName[0]) + count, NameGroupOrder{columns, groupRanks});
+  }
+
+  ArrayBuffer< bool > accepted;
+  for (size_t i = 0; i < count; ++i) {
+    accepted.push_back(false);
+  }
+  const bool checkExisting = !nameToStudentIndex.empty();
+  for (size_t i = 0; i < count; ++i) {
+    size_t r = byName[i];
+    if (i > 0) {
+      size_t prev = byName[i - 1];
+      if (columns.groupIndexes[prev] == columns.groupIndexes[r] && columns.names[prev] == columns.names[r]) {
+        continue;
+      }
+    }
+    const std::string& group = columns.groupNames[columns.groupIndexes[r]];
+    accepted[r] = !checkExisting || !studentExistsInGroup(columns.names[r], group);
+  }
+
+  const StudentID firstId = nextId;
+  ArrayBuffer< SharedPtr< student::Student > > added;
+  for (size_t r = 0; r < count; ++r) {
+    if (!accepted[r]) {
+      continue;
+    }
+    auto student = gavrilova::make_shared< student::Student >(nextId++, columns.names[r], columns.groupNames[columns.groupIndexes[r]]);
+    size_t first = columns.gradeBegins[r];
+    size_t last = columns.gradeBegins[r + 1];
+    if (first != last) {
+      struct GradeGenerator {
+        const StudentColumns& columns;
+        size_t position;
+        std::pair< date::Date, int > operator()()
+        {
+          std::pair< date::Date, int > grade(columns.dates[position], columns.marks[position]);
+          ++position;
+          return grade;
+        }
+      };
+      student->grades_.assign_sorted(last - first, GradeGenerator{columns, first});
+      const int* marks = std::addressof(columns.marks[first]);
+      student->averageGrade_ = averageOf(marks, marks + (last - first));
+    }
+    added.push_back(student);
+  }
+  const size_t addedCount = added.size();
+
+  struct StudentGenerator {
+    const ArrayBuffer< SharedPtr< student::Student > >& added;
+    size_t position;
+    std::pair< StudentID, SharedPtr< student::Student > > operator()()
+    {
+      const SharedPtr< student::Student >& student = added[position++];
+      return {student->id_, student};
+    }
+  };
+  mergeSorted(students, addedCount, StudentGenerator{added, 0});
+
+  ArrayBuffer< size_t > groupBegins;
+  for (size_t i = 0; i <= groupCount; ++i) {
+    groupBegins.push_back(0);
+  }
+  ArrayBuffer< size_t > addedGroups;
+  for (size_t r = 0; r < count; ++r) {
+    if (accepted[r]) {
+      size_t group = columns.groupIndexes[r];
+      addedGroups.push_back(group);
+      ++groupBegins[group + 1];
+    }
+  }
+  for (size_t i = 0; i < groupCount; ++i) {
+    groupBegins[i + 1] += groupBegins[i];
+  }
+  ArrayBuffer< size_t > byGroup;
+  ArrayBuffer< size_t > groupFill;
+  for (size_t i = 0; i < addedCount; ++i) {
+    byGroup.push_back(0);
+  }
+  for (size_t i = 0; i < groupCount; ++i) {
+    groupFill.push_back(groupBegins[i]);
+  }
+  for (size_t i = 0; i < addedCount; ++i) {
+    byGroup[groupFill[addedGroups[i]]++] = i;
+  }
+
+  struct MemberGenerator {
+    const ArrayBuffer< SharedPtr< student::Student > >& added;
+    const ArrayBuffer< size_t >& byGroup;
+    size_t position;
+    std::pair< StudentID, SharedPtr< student::Student > > operator()()
+    {
+      const SharedPtr< student::Student >& student = added[byGroup[position++]];
+      return {student->id_, student};
+    }
+  };
+  ArrayBuffer< size_t > newGroups;
+  for (size_t i = 0; i < groupCount; ++i) {
+    size_t group = groupOrder[i];
+    auto it = groups.find(columns.groupNames[group]);
+    if (it == groups.end()) {
+      newGroups.push_back(group);
+    } else {
+      size_t first = groupBegins[group];
+      mergeSorted(it->second, groupBegins[group + 1] - first, MemberGenerator{added, byGroup, first});
+    }
+  }
+  struct GroupGenerator {
+    const StudentColumns& columns;
+    const ArrayBuffer< SharedPtr< student::Student > >& added;
+    const ArrayBuffer< size_t >& byGroup;
+    const ArrayBuffer< size_t >& groupBegins;
+    const ArrayBuffer< size_t >& newGroups;
+    size_t position;
+    std::pair< std::string, Group > operator()()
+    {
+      size_t group = newGroups[position++];
+      size_t first = groupBegins[group];
+      std::pair< std::string, Group > value(columns.groupNames[group], Group{});
+      value.second.assign_sorted(groupBegins[group + 1] - first, MemberGenerator{added, byGroup, first});
+      return value;
+    }
+  };
+  mergeSorted(groups, newGroups.size(), GroupGenerator{columns, added, byGroup, groupBegins, newGroups, 0});
+
+  ArrayBuffer< size_t > addedByName;
+  ArrayBuffer< size_t > addedPositions;
+  for (size_t i = 0, position = 0; i < count; ++i) {
+    addedPositions.push_back(position);
+    if (accepted[i]) {
+      ++position;
+    }
+  }
+  for (size_t i = 0; i < count; ++i) {
+    if (accepted[byName[i]]) {
+      addedByName.push_back(addedPositions[byName[i]]);
+    }
+  }
+  ArrayBuffer< size_t > nameBegins;
+  for (size_t i = 0; i < addedCount; ++i) {
+    if (i == 0 || added[addedByName[i - 1]]->fullName_ != added[addedByName[i]]->fullName_) {
+      nameBegins.push_back(i);
+    }
+  }
+  nameBegins.push_back(addedCount);
+
+  struct IdGenerator {
+    const ArrayBuffer< SharedPtr< student::Student > >& added;
+    const ArrayBuffer< size_t >& addedByName;
+    size_t position;
+    std::pair< StudentID, StudentID > operator()()
+    {
+      StudentID id = added[addedByName[position++]]->id_;
+      return {id, id};
+    }
+  };
+  ArrayBuffer< size_t > newNames;
+  for (size_t i = 0; i + 1 < nameBegins.size(); ++i) {
+    size_t first = nameBegins[i];
+    size_t last = nameBegins[i + 1];
+    if (last - first > 1) {
+      std::sort(std::addressof(addedByName[first]), std::addressof(addedByName[0]) + last);
+    }
+    auto it = nameToStudentIndex.find(added[addedByName[first]]->fullName_);
+    if (it == nameToStudentIndex.end()) {
+      newNames.push_back(i);
+    } else {
+      mergeSorted(it->second, last - first, IdGenerator{added, addedByName, first});
+    }
+  }
+  struct NameGenerator {
+    const ArrayBuffer< SharedPtr< student::Student > >& added;
+    const ArrayBuffer< size_t >& addedByName;
+    const ArrayBuffer< size_t >& nameBegins;
+    const ArrayBuffer< size_t >& newNames;
+    size_t position;
+    std::pair< std::string, set< StudentID > > operator()()
+    {
+      size_t name = newNames[position++];
+      size_t first = nameBegins[name];
+      std::pair< std::string, set< StudentID > > value(added[addedByName[first]]->fullName_, set< StudentID >{});
+      value.second.assign_sorted(nameBegins[name + 1] - first, IdGenerator{added, addedByName, first});
+      return value;
+    }
+  };
+  mergeSorted(nameToStudentIndex, newNames.size(), NameGenerator{added, addedByName, nameBegins, newNames, 0});
+
+  ArrayBuffer< size_t > dayBegins;
+  for (size_t i = 0; i <= dayCount; ++i) {
+    dayBegins.push_back(0);
+  }
+  for (size_t r = 0; r < count; ++r) {
+    if (accepted[r]) {
+      for (size_t g = columns.gradeBegins[r]; g < columns.gradeBegins[r + 1]; ++g) {
+        ++dayBegins[dayIndex(columns.dates[g]) + 1];
+      }
+    }
+  }
+  for (size_t i = 0; i < dayCount; ++i) {
+    dayBegins[i + 1] += dayBegins[i];
+  }
+  ArrayBuffer< StudentID > gradeIds;
+  ArrayBuffer< int > gradeMarks;
+  for (size_t i = 0; i < dayBegins[dayCount]; ++i) {
+    gradeIds.push_back(0);
+    gradeMarks.push_back(0);
+  }
+  ArrayBuffer< size_t > dayFill(dayBegins);
+  for (size_t i = 0, r = 0; r < count; ++r) {
+    if (!accepted[r]) {
+      continue;
+    }
+    for (size_t g = columns.gradeBegins[r]; g < columns.gradeBegins[r + 1]; ++g) {
+      size_t position = dayFill[dayIndex(columns.dates[g])]++;
+      gradeIds[position] = firstId + i;
+      gradeMarks[position] = columns.marks[g];
+    }
+    ++i;
+  }
+
+  struct DateGrades {
+    const ArrayBuffer< StudentID >& ids;
+    const ArrayBuffer< int >& marks;
+    const ArrayBuffer< size_t >& dayBegins;
+
+    void pushTo(FwdList< std::pair< StudentID, int > >& list, size_t day) const
+    {
+      for (size_t i = dayBegins[day]; i < dayBegins[day + 1]; ++i) {
+        list.push_front({ids[i], marks[i]});
+      }
+    }
+  };
+  DateGrades dateGrades{gradeIds, gradeMarks, dayBegins};
+  ArrayBuffer< size_t > newDays;
+  for (size_t day = 0; day < dayCount; ++day) {
+    if (dayBegins[day] == dayBegins[day + 1]) {
+      continue;
+    }
+    auto it = dateToGradesIndex.find(dateOfDay(day));
+    if (it == dateToGradesIndex.end()) {
+      newDays.push_back(day);
+    } else {
+      dateGrades.pushTo(it->second, day);
+    }
+  }
+  struct DateGenerator {
+    const DateGrades& dateGrades;
+    const ArrayBuffer< size_t >& newDays;
+    size_t position;
+    std::pair< date::Date, FwdList< std::pair< StudentID, int > > > operator()()
+    {
+      size_t day = newDays[position++];
+      std::pair< date::Date, FwdList< std::pair< StudentID, int > > > value(dateOfDay(day), {});
+      dateGrades.pushTo(value.second, day);
+      return value;
+    }
+  };
+  mergeSorted(dateToGradesIndex, newDays.size(), DateGenerator{dateGrades, newDays, 0});
+}
+
 void gavrilova::StudentDatabase::clear()
 {
   students.clear();
@@ -107,6 +728,27 @@ std::pair< bool, gavrilova::StudentID > gavrilova::StudentDatabase::addStudent(c
   if (!groupExists(groupName)) {
     return {false, 0};
   }
+  if (studentExistsInGroup(fullName, groupName)) {
+    return {false, 0};
+  }
+
+  auto student = gavrilova::make_shared< student::Student >(nextId, fullName, groupName);
+  students.insert({nextId, student});
+  groups.at(groupName).insert({nextId, student});
+
+  auto name_set_it = nameToStudentIndex.find(fullName);
+  if (name_set_it == nameToStudentIndex.end()) {
+    gavrilova::set< StudentID > new_set;
+    new_set.insert({nextId, nextId});
+    nameToStudentIndex.insert({fullName, new_set});
+  } else {
+    name_set_it->second.insert({nextId, nextId});
+  }
+  return {true, nextId++};
+}
+
+bool gavrilova::StudentDatabase::studentExistsInGroup(const std::string& fullName, const std::string& groupName) const
+{
   auto it_name = nameToStudentIndex.find(fullName);
   if (it_name != nameToStudentIndex.end()) {
     struct StudentExistsInGroupChecker {
@@ -124,24 +766,9 @@ std::pair< bool, gavrilova::StudentID > gavrilova::StudentDatabase::addStudent(c
     };
     bool student_exists_in_group = false;
     it_name->second.traverse_lnr(StudentExistsInGroupChecker{this, groupName, student_exists_in_group});
-    if (student_exists_in_group) {
-      return {false, 0};
-    }
+    return student_exists_in_group;
   }
-
-  auto student = gavrilova::make_shared< student::Student >(nextId, fullName, groupName);
-  students.insert({nextId, student});
-  groups.at(groupName).insert({nextId, student});
-
-  auto name_set_it = nameToStudentIndex.find(fullName);
-  if (name_set_it == nameToStudentIndex.end()) {
-    gavrilova::set< StudentID > new_set;
-    new_set.insert({nextId, nextId});
-    nameToStudentIndex.insert({fullName, new_set});
-  } else {
-    name_set_it->second.insert({nextId, nextId});
-  }
-  return {true, nextId++};
+  return false;
 }
 
 bool gavrilova::StudentDatabase::deleteStudent(StudentID id)
@@ -29,6 +29,7 @@ namespace gavrilova {
     explicit StudentDatabase(int id_digits = 4);
 
     bool saveToFile(const std::string& filename) const;
+    bool saveToBinaryFile(const std::string& filename) const;
     bool loadFromFile(const std::string& filename);
     void clear();
 
@@ -61,11 +62,16 @@ namespace gavrilova {
     void updateStudentAverageGrade(SharedPtr< student::Student >& student);
 
   private:
+    struct StudentColumns;
+
     map< StudentID, SharedPtr< student::Student > > students;
     map< std::string, Group > groups;
     map< std::string, set< StudentID > > nameToStudentIndex;
     map< date::Date, FwdList< std::pair< StudentID, int > > > dateToGradesIndex;
     StudentID nextId;
+
+    bool studentExistsInGroup(const std::string& fullName, const std::string& groupName) const;
+    void addColumns(const StudentColumns& columns);
   };
 }
 
@@ -680,3 +680,35 @@ BOOST_AUTO_TEST_CASE(TestRangeEraseBoundaryCases)
   tree.erase(tree.begin(), tree.end());
   BOOST_TEST(tree.empty());
 }
+
+BOOST_AUTO_TEST_CASE(TestAssignSorted)
+{
+  for (int n = 0; n <= 100; ++n) {
+    gavrilova::TwoThreeTree< int, std::string > tree;
+    tree.insert({-1, "old"});
+    int next = 0;
+    tree.assign_sorted(n, [&next]() {
+      int key = next++ * 2;
+      return std::make_pair(key, std::to_string(key));
+    });
+    BOOST_TEST(tree.size() == static_cast< size_t >(n));
+    BOOST_CHECK(tree.find(-1) == tree.end());
+
+    int expected = 0;
+    for (auto it = tree.begin(); it != tree.end(); ++it) {
+      BOOST_TEST(it->first == expected);
+      BOOST_TEST(it->second == std::to_string(expected));
+      expected += 2;
+    }
+    BOOST_TEST(expected == n * 2);
+
+    for (int key = 0; key < n * 2; ++key) {
+      BOOST_TEST((tree.find(key) != tree.end()) == (key % 2 == 0));
+    }
+    tree.insert({1, "one"});
+    BOOST_TEST(tree.size() == static_cast< size_t >(n + 1));
+    BOOST_CHECK(tree.find(1) != tree.end());
+    BOOST_TEST(tree.erase(1) == 1);
+    BOOST_TEST(tree.size() == static_cast< size_t >(n));
+  }
+}
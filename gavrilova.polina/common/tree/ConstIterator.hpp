@@ -80,7 +80,7 @@ namespace gavrilova {
       } else {
         const Node* parent = node_->parent;
         const Node* child = node_;
-        while (parent && !parent->is_fake && parent->children[0] != child) {
+        while (parent && !parent->is_fake && parent->children[parent->is_3_node ? 2 : 1] == child) {
           child = parent;
           parent = parent->parent;
         }
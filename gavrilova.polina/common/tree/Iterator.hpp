@@ -70,7 +70,7 @@ namespace gavrilova {
       } else {
         Node* parent = node_->parent;
         Node* child = node_;
-        while (parent && !parent->is_fake && parent->children[0] != child) {
+        while (parent && !parent->is_fake && parent->children[parent->is_3_node ? 2 : 1] == child) {
           child = parent;
           parent = parent->parent;
         }
@@ -61,6 +61,8 @@ namespace gavrilova {
     template < class InputIterator >
     void insert(InputIterator first, InputIterator last);
     void insert(std::initializer_list< value_type > il);
+    template < class Generator >
+    void assign_sorted(size_t count, Generator gen);
 
     size_t erase(const Key& key);
     Iterator erase(Iterator pos);
@@ -106,6 +108,8 @@ namespace gavrilova {
     Node* find_leaf(const Key& key, size_t& counter_for_allocate);
 
     void push_to_2node(Node* node, const Key& key, const Value& value);
+    template < class Generator >
+    void fill_sorted(Node* node, size_t count, size_t capacity, Generator& gen);
 
     void rebalance(Node* node);
     void rotation(Node* deficient_node, Node* sibling, Node* parent, int deficient_idx);
@@ -488,6 +492,60 @@ namespace gavrilova {
     insert(il.begin(), il.end());
   }
 
+  template < class Key, class Value, class Cmp >
+  template < class Generator >
+  void TwoThreeTree< Key, Value, Cmp >::assign_sorted(size_t count, Generator gen)
+  {
+    clear();
+    if (count == 0) {
+      return;
+    }
+    size_t capacity = 2;
+    while (capacity < count) {
+      capacity = capacity * 3 + 2;
+    }
+    Node* root = new Node();
+    root->parent = fake_;
+    root->children[0] = root->children[1] = root->children[2] = fake_;
+    try {
+      fill_sorted(root, count, capacity, gen);
+    } catch (...) {
+      clear_recursive(root);
+      throw;
+    }
+    fake_->children[0] = root;
+    size_ = count;
+  }
+
+  template < class Key, class Value, class Cmp >
+  template < class Generator >
+  void TwoThreeTree< Key, Value, Cmp >::fill_sorted(Node* node, size_t count, size_t capacity, Generator& gen)
+  {
+    if (capacity == 2) {
+      node->data[0] = gen();
+      if (count == 2) {
+        node->data[1] = gen();
+        node->is_3_node = true;
+      }
+      return;
+    }
+    size_t child_capacity = (capacity - 2) / 3;
+    size_t children_count = (count <= child_capacity * 2 + 1) ? 2 : 3;
+    size_t rest = count - (children_count - 1);
+    for (size_t i = 0; i < children_count; ++i) {
+      Node* child = new Node();
+      child->parent = node;
+      child->children[0] = child->children[1] = child->children[2] = fake_;
+      node->children[i] = child;
+      size_t part = rest / children_count + (i < rest % children_count ? 1 : 0);
+      fill_sorted(child, part, child_capacity, gen);
+      if (i + 1 < children_count) {
+        node->data[i] = gen();
+      }
+    }
+    node->is_3_node = children_count == 3;
+  }
+
   template < class Key, class Value, class Cmp >
   typename TwoThreeTree< Key, Value, Cmp >::Iterator
   TwoThreeTree< Key, Value, Cmp >::erase(Iterator pos)
@@ -1,5 +1,6 @@
 #include <boost/test/unit_test.hpp>
 
+#include <random>
 #include <sstream>
 #include <string>
 #include <tree/avl_tree.hpp>
@@ -55,3 +56,89 @@ BOOST_AUTO_TEST_CASE(traversal_breadth_test)
   BOOST_TEST(res_breadth.result_ == 35);
   BOOST_TEST(res_breadth.itInput_ == "root left right leftleft leftright rightleft rightright");
 }
+
+BOOST_AUTO_TEST_CASE(traversal_const_test)
+{
+  karnauhova::AvlTree< int, std::string > tree;
+  tree[5] = "root";
+  tree[3] = "left";
+  tree[7] = "right";
+  tree[4] = "leftright";
+  const karnauhova::AvlTree< int, std::string >& ctree = tree;
+
+  karnauhova::KeySum res_lnr;
+  res_lnr = ctree.traverse_lnr(res_lnr);
+  BOOST_TEST(res_lnr.itInput_ == "left leftright root right");
+  karnauhova::KeySum res_rnl;
+  res_rnl = ctree.traverse_rnl(res_rnl);
+  BOOST_TEST(res_rnl.itInput_ == "right root leftright left");
+}
+
+BOOST_AUTO_TEST_CASE(traversal_iterator_copy_test)
+{
+  karnauhova::AvlTree< int, std::string > tree;
+  for (int i = 0; i < 20; ++i)
+  {
+    tree[(i * 7) % 20] = std::to_string(i);
+  }
+  auto it = tree.lnrBegin();
+  ++it;
+  auto copy = it;
+  ++it;
+  ++it;
+  BOOST_TEST(copy->first == 1);
+  BOOST_TEST(it->first == 3);
+  auto rit = tree.rnlBegin();
+  auto rcopy = rit++;
+  BOOST_TEST(rcopy->first == 19);
+  BOOST_TEST(rit->first == 18);
+  tree.erase(10);
+  int expected = 0;
+  for (auto i = tree.lnrBegin(); i != tree.lnrEnd(); ++i)
+  {
+    expected += expected == 10;
+    BOOST_TEST(i->first == expected);
+    ++expected;
+  }
+  BOOST_TEST(expected == 20);
+}
+
+BOOST_AUTO_TEST_CASE(traversal_random_tree_test)
+{
+  karnauhova::AvlTree< int, std::string > tree;
+  std::minstd_rand generator(1000);
+  for (int i = 0; i < 1000; ++i)
+  {
+    int key = static_cast< int >(generator() % 4000);
+    tree[key] = std::to_string(key);
+  }
+  karnauhova::KeySum expected_lnr;
+  std::string expected_rnl;
+  for (auto it = tree.begin(); it != tree.end(); ++it)
+  {
+    expected_lnr(*it);
+    expected_rnl = expected_rnl.empty() ? it->second : it->second + " " + expected_rnl;
+  }
+  const karnauhova::AvlTree< int, std::string >& ctree = tree;
+
+  karnauhova::KeySum res_lnr = tree.traverse_lnr(karnauhova::KeySum{});
+  BOOST_TEST(res_lnr.result_ == expected_lnr.result_);
+  BOOST_TEST(res_lnr.itInput_ == expected_lnr.itInput_);
+  karnauhova::KeySum res_rnl = tree.traverse_rnl(karnauhova::KeySum{});
+  BOOST_TEST(res_rnl.result_ == expected_lnr.result_);
+  BOOST_TEST(res_rnl.itInput_ == expected_rnl);
+  karnauhova::KeySum res_clnr = ctree.traverse_lnr(karnauhova::KeySum{});
+  BOOST_TEST(res_clnr.itInput_ == expected_lnr.itInput_);
+  karnauhova::KeySum res_crnl = ctree.traverse_rnl(karnauhova::KeySum{});
+  BOOST_TEST(res_crnl.itInput_ == expected_rnl);
+
+  size_t steps = 0;
+  auto it = tree.lnrBegin();
+  auto end = tree.lnrEnd();
+  while (it != end)
+  {
+    auto copy = it++;
+    steps += copy != it;
+  }
+  BOOST_TEST(steps == tree.size());
+}
@@ -26,7 +26,7 @@ namespace karnauhova
     using LnrIter = LnrIterator< Key, Value, Compare >;
     using CLnrIter = CLnrIterator< Key, Value, Compare >;
     using RnlIter = RnlIterator< Key, Value, Compare >;
-    using CRnlIter = RnlIterator< Key, Value, Compare >;
+    using CRnlIter = CRnlIterator< Key, Value, Compare >;
 
     explicit AvlTree(Compare cmp = Compare{});
     AvlTree(const AvlTree< Key, Value, Compare >&, Compare cmp = Compare{});
@@ -625,13 +625,7 @@ namespace karnauhova
   template< typename Key, typename Value, typename Compare >
   typename AvlTree< Key, Value, Compare >::LnrIter AvlTree< Key, Value, Compare >::lnrBegin() const noexcept
   {
-    auto begin = LnrIter(fake_->left, fake_);
-    while (begin.node_->left != fake_)
-    {
-      begin.stack_.push(begin.node_);
-      begin.node_ = begin.node_->left;
-    }
-    return begin;
+    return LnrIter(detail::lnrFirst(fake_->left, fake_), fake_);
   }
 
   template< typename Key, typename Value, typename Compare >
@@ -655,13 +649,7 @@ namespace karnauhova
   template< typename Key, typename Value, typename Compare >
   typename AvlTree< Key, Value, Compare >::RnlIter AvlTree< Key, Value, Compare >::rnlBegin() const noexcept
   {
-    auto begin = RnlIter(fake_->left, fake_);
-    while (begin.node_->right != fake_)
-    {
-      begin.stack_.push(begin.node_);
-      begin.node_ = begin.node_->right;
-    }
-    return begin;
+    return RnlIter(detail::rnlFirst(fake_->left, fake_), fake_);
   }
 
   template< typename Key, typename Value, typename Compare >
@@ -11,6 +11,58 @@ namespace karnauhova::detail
     AvlTreeNode< Key, Value >* left, * right, * parent;
     int height;
   };
+
+  template< typename Key, typename Value >
+  AvlTreeNode< Key, Value >* lnrFirst(AvlTreeNode< Key, Value >* node, AvlTreeNode< Key, Value >* fake) noexcept
+  {
+    while (node->left != fake)
+    {
+      node = node->left;
+    }
+    return node;
+  }
+
+  template< typename Key, typename Value >
+  AvlTreeNode< Key, Value >* rnlFirst(AvlTreeNode< Key, Value >* node, AvlTreeNode< Key, Value >* fake) noexcept
+  {
+    while (node->right != fake)
+    {
+      node = node->right;
+    }
+    return node;
+  }
+
+  template< typename Key, typename Value >
+  AvlTreeNode< Key, Value >* lnrNext(AvlTreeNode< Key, Value >* node, AvlTreeNode< Key, Value >* fake) noexcept
+  {
+    if (node->right != fake)
+    {
+      return lnrFirst(node->right, fake);
+    }
+    AvlTreeNode< Key, Value >* parent = node->parent;
+    while (parent != fake && node == parent->right)
+    {
+      node = parent;
+      parent = parent->parent;
+    }
+    return parent;
+  }
+
+  template< typename Key, typename Value >
+  AvlTreeNode< Key, Value >* rnlNext(AvlTreeNode< Key, Value >* node, AvlTreeNode< Key, Value >* fake) noexcept
+  {
+    if (node->left != fake)
+    {
+      return rnlFirst(node->left, fake);
+    }
+    AvlTreeNode< Key, Value >* parent = node->parent;
+    while (parent != fake && node == parent->left)
+    {
+      node = parent;
+      parent = parent->parent;
+    }
+    return parent;
+  }
 }
 
 #endif
@@ -2,7 +2,6 @@
 #define CLNR_ITERATOR_HPP
 #include <functional>
 #include "avltree_node.hpp"
-#include <stack.hpp>
 namespace karnauhova
 {
   template< typename Key, typename Value, typename Compare >
@@ -34,30 +33,26 @@ namespace karnauhova
     bool operator==(const this_t&) const noexcept;
     bool operator!=(const this_t&) const noexcept;
   private:
-    Stack< Node* > stack_;
     Node* node_;
     Node* fake_;
   };
 
   template< typename Key, typename Value, typename Compare>
   CLnrIterator< Key, Value, Compare >::CLnrIterator() noexcept:
-    stack_(),
     node_(nullptr),
     fake_(nullptr)
   {}
 
   template< typename Key, typename Value, typename Compare>
   CLnrIterator< Key, Value, Compare >::CLnrIterator(Node* node, Node* fake) noexcept:
-    stack_(),
     node_(node),
     fake_(fake)
   {}
 
   template< typename Key, typename Value, typename Compare>
   CLnrIterator< Key, Value, Compare >::CLnrIterator(const LnrIterator< Key, Value, Compare >& copy) noexcept:
-    stack_(copy.stack_),
-    node_(copy.node),
-    fake_(copy.fake)
+    node_(copy.node_),
+    fake_(copy.fake_)
   {}
 
   template< typename Key, typename Value, typename Compare>
@@ -67,33 +62,7 @@ namespace karnauhova
     {
       return *this;
     }
-    if (node_->right != fake_)
-    {
-      stack_.push(node_);
-      node_ = node_->right;
-      while (node_->left != fake_)
-      {
-        stack_.push(node_);
-        node_ = node_->left;
-      }
-    }
-    else
-    {
-      while (!stack_.empty() && stack_.top()->right == node_)
-      {
-        node_ = stack_.top();
-        stack_.pop();
-      }
-      if (stack_.empty())
-      {
-        node_ = fake_;
-      }
-      else
-      {
-        node_ = stack_.top();
-        stack_.pop();
-      }
-    }
+    node_ = detail::lnrNext(node_, fake_);
     return *this;
   }
 
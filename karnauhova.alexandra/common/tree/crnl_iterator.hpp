@@ -1,7 +1,6 @@
 #ifndef CRNL_ITERATOR_HPP
 #define CRNL_ITERATOR_HPP
 #include <functional>
-#include <stack.hpp>
 #include "avltree_node.hpp"
 
 namespace karnauhova
@@ -35,30 +34,26 @@ namespace karnauhova
     bool operator==(const this_t&) const noexcept;
     bool operator!=(const this_t&) const noexcept;
   private:
-    Stack< Node* > stack_;
     Node* node_;
     Node* fake_;
   };
 
   template< typename Key, typename Value, typename Compare>
   CRnlIterator< Key, Value, Compare >::CRnlIterator() noexcept:
-    stack_(),
     node_(nullptr),
     fake_(nullptr)
   {}
 
   template< typename Key, typename Value, typename Compare>
   CRnlIterator< Key, Value, Compare >::CRnlIterator(Node* node, Node* fake) noexcept:
-    stack_(),
     node_(node),
     fake_(fake)
   {}
 
   template< typename Key, typename Value, typename Compare>
   CRnlIterator< Key, Value, Compare >::CRnlIterator(const RnlIterator< Key, Value, Compare >& copy) noexcept:
-    stack_(copy.stack_),
-    node_(copy.node),
-    fake_(copy.fake)
+    node_(copy.node_),
+    fake_(copy.fake_)
   {}
 
   template< typename Key, typename Value, typename Compare>
@@ -68,33 +63,7 @@ namespace karnauhova
     {
       return *this;
     }
-    if (node_->left != fake_)
-    {
-      stack_.push(node_);
-      node_ = node_->left;
-      while (node_->right != fake_)
-      {
-        stack_.push(node_);
-        node_ = node_->right;
-      }
-    }
-    else
-    {
-      while (!stack_.empty() && stack_.top()->left == node_)
-      {
-        node_ = stack_.top();
-        stack_.pop();
-      }
-      if (stack_.empty())
-      {
-        node_ = fake_;
-      }
-      else
-      {
-        node_ = stack_.top();
-        stack_.pop();
-      }
-    }
+    node_ = detail::rnlNext(node_, fake_);
     return *this;
   }
 
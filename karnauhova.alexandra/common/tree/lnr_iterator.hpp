@@ -2,16 +2,19 @@
 #define LNR_ITERATOR_HPP
 #include <functional>
 #include "avltree_node.hpp"
-#include <stack.hpp>
 namespace karnauhova
 {
   template< typename Key, typename Value, typename Compare >
   class AvlTree;
 
+  template< typename Key, typename Value, typename Compare >
+  class CLnrIterator;
+
   template< typename Key, typename Value, typename Compare = std::less< Key > >
   struct LnrIterator: public std::iterator< std::forward_iterator_tag, Key, Value, Compare >
   {
     friend class AvlTree< Key, Value, Compare >;
+    friend class CLnrIterator< Key, Value, Compare >;
   public:
     using Node = detail::AvlTreeNode< Key, Value >;
     using this_t = LnrIterator< Key, Value, Compare >;
@@ -29,21 +32,18 @@ namespace karnauhova
     bool operator==(const this_t&) const noexcept;
     bool operator!=(const this_t&) const noexcept;
   private:
-    Stack< Node* > stack_;
     Node* node_;
     Node* fake_;
   };
 
   template< typename Key, typename Value, typename Compare>
   LnrIterator< Key, Value, Compare >::LnrIterator() noexcept:
-    stack_(),
     node_(nullptr),
     fake_(nullptr)
   {}
 
   template< typename Key, typename Value, typename Compare>
   LnrIterator< Key, Value, Compare >::LnrIterator(Node* node, Node* fake) noexcept:
-    stack_(),
     node_(node),
     fake_(fake)
   {}
@@ -55,33 +55,7 @@ namespace karnauhova
     {
       return *this;
     }
-    if (node_->right != fake_)
-    {
-      stack_.push(node_);
-      node_ = node_->right;
-      while (node_->left != fake_)
-      {
-        stack_.push(node_);
-        node_ = node_->left;
-      }
-    }
-    else
-    {
-      while (!stack_.empty() && stack_.top()->right == node_)
-      {
-        node_ = stack_.top();
-        stack_.pop();
-      }
-      if (stack_.empty())
-      {
-        node_ = fake_;
-      }
-      else
-      {
-        node_ = stack_.top();
-        stack_.pop();
-      }
-    }
+    node_ = detail::lnrNext(node_, fake_);
     return *this;
   }
 
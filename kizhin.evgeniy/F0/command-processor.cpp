@@ -1,6 +1,5 @@
 #include "command-processor.hpp"
 #include <algorithm>
-#include <fstream>
 #include <functional>
 #include <iomanip>
 #include <iostream>
@@ -11,17 +10,18 @@
 #include <tuple>
 #include <map.hpp>
 #include "freq-dict.hpp"
+#include "wildcard.hpp"
 
 namespace kizhin {
-  bool isSatisfied(const std::string& str, const std::string& regexp);
   std::string wordAndSizeToString(const WordAndSize&);
   float getFreq(const FrequencyDictionary&, const WordAndSize&);
   void outWordInfo(std::ostream&, const FrequencyDictionary&, const WordAndSize&);
 }
 
-kizhin::CommandProcessor::CommandProcessor(State& state, std::istream& in,
-    std::ostream& out, std::ostream& err) noexcept:
+kizhin::CommandProcessor::CommandProcessor(State& state, DictionaryCache& cache,
+    std::istream& in, std::ostream& out, std::ostream& err) noexcept:
   state_(state),
+  cache_(cache),
   in_(in),
   out_(out),
   err_(err)
@@ -193,12 +193,12 @@ void kizhin::CommandProcessor::handleInter(const CmdArgs& args) const
     err_ << "Unknown dictionary: " << args[state_.count(args[0])] << '\n';
     return;
   }
-  const FrequencyDictionary first = loadDictionary(state_[args[0]]);
-  const FrequencyDictionary second = loadDictionary(state_[args[1]]);
+  const DictPtr first = loadDictionary(state_[args[0]]);
+  const DictPtr second = loadDictionary(state_[args[1]]);
   std::set< std::string > intersection{};
   const auto ins = std::inserter(intersection, intersection.end());
-  const WordSet& firstW = first.wordSet;
-  const WordSet& secondW = second.wordSet;
+  const WordSet& firstW = first->wordSet;
+  const WordSet& secondW = second->wordSet;
   const auto beg = firstW.begin();
   std::set_intersection(beg, firstW.end(), secondW.begin(), secondW.end(), ins);
   WordMap result{};
@@ -208,7 +208,7 @@ void kizhin::CommandProcessor::handleInter(const CmdArgs& args) const
   static const auto getFirst = std::bind(&WordMap::value_type::first, _1);
   const auto interPtr = std::addressof(intersection);
   const auto contains = std::bind(count, interPtr, std::bind(getFirst, _1));
-  std::copy_if(first.wordMap.begin(), first.wordMap.end(), inserter, contains);
+  std::copy_if(first->wordMap.begin(), first->wordMap.end(), inserter, contains);
   using OutIt = std::ostream_iterator< std::string >;
   std::transform(result.begin(), result.end(), OutIt{ out_, "\n" }, wordAndSizeToString);
 }
@@ -223,13 +223,13 @@ void kizhin::CommandProcessor::handleDiff(const CmdArgs& args) const
     err_ << "Unknown dictionary: " << args[state_.count(args[0])] << '\n';
     return;
   }
-  const FrequencyDictionary first = loadDictionary(state_[args[0]]);
-  const FrequencyDictionary second = loadDictionary(state_[args[1]]);
+  const DictPtr first = loadDictionary(state_[args[0]]);
+  const DictPtr second = loadDictionary(state_[args[1]]);
   using std::placeholders::_1;
   std::set< std::string > difference{};
   const auto ins = std::inserter(difference, difference.end());
-  const WordSet& firstW = first.wordSet;
-  const WordSet& secondW = second.wordSet;
+  const WordSet& firstW = first->wordSet;
+  const WordSet& secondW = second->wordSet;
   std::set_difference(firstW.begin(), firstW.end(), secondW.begin(), secondW.end(), ins);
   WordMap result{};
   const auto inserter = std::inserter(result, result.end());
@@ -237,7 +237,7 @@ void kizhin::CommandProcessor::handleDiff(const CmdArgs& args) const
   static const auto getFirst = std::bind(&WordMap::value_type::first, _1);
   const auto diffPtr = std::addressof(difference);
   const auto contains = std::bind(count, diffPtr, std::bind(getFirst, _1));
-  std::copy_if(first.wordMap.begin(), first.wordMap.end(), inserter, contains);
+  std::copy_if(first->wordMap.begin(), first->wordMap.end(), inserter, contains);
   using OutIt = std::ostream_iterator< std::string >;
   std::transform(result.begin(), result.end(), OutIt{ out_, "\n" }, wordAndSizeToString);
 }
@@ -251,8 +251,8 @@ void kizhin::CommandProcessor::handleStat(const CmdArgs& args) const
     err_ << "Unknown dictionary: " << args[0] << '\n';
     return;
   }
-  const FrequencyDictionary dict = loadDictionary(state_.at(args[0]));
-  const SizeSet& freqDict = dict.sizeSet;
+  const DictPtr dict = loadDictionary(state_.at(args[0]));
+  const SizeSet& freqDict = dict->sizeSet;
   if (freqDict.empty()) {
     out_ << "Dictionary is empty\n";
     return;
@@ -262,7 +262,7 @@ void kizhin::CommandProcessor::handleStat(const CmdArgs& args) const
   out_ << std::setw(titleWidth) << std::left << "Unique words";
   out_ << std::setw(countWidth) << std::left << freqDict.size() << '\n';
   out_ << std::setw(titleWidth) << std::left << "Total words";
-  out_ << std::setw(countWidth) << std::left << dict.total << '\n';
+  out_ << std::setw(countWidth) << std::left << dict->total << '\n';
   out_ << std::setw(titleWidth) << std::left << "Most frequent";
   out_ << std::setw(countWidth) << std::left << freqDict.begin()->second;
   using std::placeholders::_1;
@@ -293,8 +293,8 @@ void kizhin::CommandProcessor::handleTop(const CmdArgs& args) const
     return;
   }
   const std::size_t count = args.size() == 2 ? std::stoull(args[1]) : 5;
-  const FrequencyDictionary dict = loadDictionary(state_[args[0]]);
-  const SizeSet& freqDict = dict.sizeSet;
+  const DictPtr dict = loadDictionary(state_[args[0]]);
+  const SizeSet& freqDict = dict->sizeSet;
   const bool beforeEnd = count < freqDict.size();
   const auto end = beforeEnd ? std::next(freqDict.begin(), count) : freqDict.end();
   using OutIt = std::ostream_iterator< std::string >;
@@ -311,8 +311,8 @@ void kizhin::CommandProcessor::handleBot(const CmdArgs& args) const
     return;
   }
   const std::size_t count = args.size() == 2 ? std::stoull(args[1]) : 5;
-  FrequencyDictionary dict = loadDictionary(state_[args[0]]);
-  const SizeSet& freqDict = dict.sizeSet;
+  const DictPtr dict = loadDictionary(state_[args[0]]);
+  const SizeSet& freqDict = dict->sizeSet;
   const bool beforeEnd = count < freqDict.size();
   const auto beg = beforeEnd ? std::next(freqDict.rbegin(), count) : freqDict.rend();
   using OutIt = std::ostream_iterator< std::string >;
@@ -335,12 +335,12 @@ void kizhin::CommandProcessor::handleRange(const CmdArgs& args) const
     err_ << "Requirements: 0.0 <= min <= max <= 1.0\n";
     return;
   }
-  const FrequencyDictionary dict = loadDictionary(state_[args[0]]);
-  const SizeSet& freqDict = dict.sizeSet;
-  const auto begin = freqDict.upper_bound({ "", max * dict.total });
-  const auto end = freqDict.lower_bound({ "", min * dict.total });
+  const DictPtr dict = loadDictionary(state_[args[0]]);
+  const SizeSet& freqDict = dict->sizeSet;
+  const auto begin = freqDict.upper_bound({ "", max * dict->total });
+  const auto end = freqDict.lower_bound({ "", min * dict->total });
   using std::placeholders::_1;
-  const auto printer = std::bind(&outWordInfo, std::ref(out_), std::cref(dict), _1);
+  const auto printer = std::bind(&outWordInfo, std::ref(out_), std::cref(*dict), _1);
   std::for_each(begin, end, printer);
 }
 
@@ -353,15 +353,32 @@ void kizhin::CommandProcessor::handleFind(const CmdArgs& args) const
     err_ << "Unknown dictionary: " << args[0] << '\n';
     return;
   }
-  const FrequencyDictionary dict = loadDictionary(state_.at(args[0]));
-  const WordMap& wordMap = dict.wordMap;
+  const State::mapped_type& files = state_.at(args[0]);
+  const DictPtr dict = loadDictionary(files);
+  const WordMap& wordMap = dict->wordMap;
+  const WildcardPattern pattern(args[1]);
   WordMap result{};
-  using std::placeholders::_1;
-  const auto inserter = std::inserter(result, result.end());
-  static const auto getFirst = std::bind(&WordMap::value_type::first, _1);
-  static const auto validator = std::addressof(isSatisfied);
-  const auto isRight = std::bind(validator, std::bind(getFirst, _1), std::cref(args[1]));
-  std::copy_if(wordMap.begin(), wordMap.end(), inserter, isRight);
+  if (pattern.isLiteral()) {
+    const auto pos = wordMap.find(args[1]);
+    if (pos != wordMap.end()) {
+      result.insert(*pos);
+    }
+  } else if (pattern.prefix().empty() && !pattern.suffix().empty()) {
+    const SuffixIndexPtr index = cache_.getSuffixIndex(files);
+    const SuffixIndex::Range range = index->equalRange(pattern.suffix());
+    for (auto pos = range.first; pos != range.second; ++pos) {
+      if (pattern((*pos)->first)) {
+        result.insert(**pos);
+      }
+    }
+  } else {
+    using std::placeholders::_1;
+    const auto inserter = std::inserter(result, result.end());
+    static const auto getFirst = std::bind(&WordMap::value_type::first, _1);
+    const auto isRight = std::bind(std::cref(pattern), std::bind(getFirst, _1));
+    const WordMapRange range = prefixRange(wordMap, pattern.prefix());
+    std::copy_if(range.first, range.second, inserter, isRight);
+  }
   using OutIt = std::ostream_iterator< std::string >;
   std::transform(result.begin(), result.end(), OutIt{ out_, "\n" }, wordAndSizeToString);
 }
@@ -378,33 +395,10 @@ void kizhin::CommandProcessor::outDictionary(const State::key_type& dictionary)
   out_ << '\n';
 }
 
-kizhin::FrequencyDictionary kizhin::CommandProcessor::loadDictionary(
+kizhin::DictPtr kizhin::CommandProcessor::loadDictionary(
     const std::vector< std::string >& files) const
 {
-  FrequencyDictionary result{};
-  using std::placeholders::_1;
-  const auto expander = std::bind(std::addressof(expandDictionary), _1, std::ref(result));
-  std::vector< std::ifstream > fins(files.begin(), files.end());
-  std::for_each(fins.begin(), fins.end(), expander);
-  return result;
-}
-
-bool kizhin::isSatisfied(const std::string& str, const std::string& reg)
-{
-  auto strPos = str.begin();
-  auto regPos = reg.begin();
-  std::tie(strPos, regPos) = std::mismatch(strPos, str.end(), regPos, reg.end());
-  while (strPos != str.end() && regPos != reg.end()) {
-    if (*regPos == '*') {
-      strPos = std::find(strPos, str.end(), *(++regPos));
-    } else {
-      return false;
-    }
-    std::tie(strPos, regPos) = std::mismatch(strPos, str.end(), regPos, reg.end());
-  }
-  const bool isRegEnd = regPos == reg.end();
-  const bool doesMathcAny = (*regPos == '*' && std::next(regPos) == reg.end());
-  return strPos == str.end() && (isRegEnd || doesMathcAny);
+  return cache_.get(files);
 }
 
 std::string kizhin::wordAndSizeToString(const WordAndSize& val)
@@ -5,6 +5,7 @@
 #include <string>
 #include <utility>
 #include <vector>
+#include "dict-cache.hpp"
 #include "freq-dict.hpp"
 #include "state.hpp"
 
@@ -12,13 +13,15 @@ namespace kizhin {
   class CommandProcessor
   {
   public:
-    CommandProcessor(State&, std::istream&, std::ostream&, std::ostream&) noexcept;
+    CommandProcessor(State&, DictionaryCache&, std::istream&, std::ostream&,
+        std::ostream&) noexcept;
     void processCommands();
 
   private:
     using CmdArgs = std::vector< std::string >;
 
     State& state_;
+    DictionaryCache& cache_;
     std::istream& in_;
     std::ostream& out_;
     std::ostream& err_;
@@ -43,7 +46,7 @@ namespace kizhin {
     void handleFind(const CmdArgs&) const;
 
     void outDictionary(const State::key_type&) const;
-    FrequencyDictionary loadDictionary(const std::vector< std::string >&) const;
+    DictPtr loadDictionary(const std::vector< std::string >&) const;
   };
 }
 
@@ -0,0 +1,194 @@
+#include "dict-cache.hpp"
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <sys/stat.h>
+
+namespace kizhin {
+  FrequencyDictionary buildDictionary(const DictionaryCache::FileList&);
+
+  template < typename T >
+  void writeBinary(std::ostream&, T);
+  void writeBinary(std::ostream&, const std::string&);
+  template < typename T >
+  bool readBinary(std::istream&, T&);
+  bool readBinary(std::istream&, std::string&);
+
+  constexpr char cacheMagic[] = { 'K', 'F', 'D', 'C' };
+  constexpr std::uint32_t cacheVersion = 1;
+}
+
+bool kizhin::DictionaryCache::FileStamp::operator==(const FileStamp& rhs) const noexcept
+{
+  return size == rhs.size && mtime == rhs.mtime;
+}
+
+kizhin::DictPtr kizhin::DictionaryCache::get(const FileList& files)
+{
+  Stamps stamps = getStamps(files);
+  const auto pos = entries_.find(files);
+  if (pos != entries_.end() && pos->second.stamps == stamps) {
+    return pos->second.dict;
+  }
+  DictPtr dict = std::make_shared< const FrequencyDictionary >(buildDictionary(files));
+  entries_[files] = Entry{ std::move(stamps), dict };
+  return dict;
+}
+
+kizhin::SuffixIndexPtr kizhin::DictionaryCache::getSuffixIndex(const FileList& files)
+{
+  DictPtr dict = get(files);
+  Entry& entry = entries_.at(files);
+  if (!entry.suffixIndex) {
+    entry.suffixIndex = std::make_shared< const SuffixIndex >(std::move(dict));
+  }
+  return entry.suffixIndex;
+}
+
+kizhin::DictionaryCache::Stamps kizhin::DictionaryCache::getStamps(const FileList& files)
+{
+  Stamps result(files.size());
+  for (std::size_t i = 0; i != files.size(); ++i) {
+    struct stat info{};
+    if (::stat(files[i].c_str(), std::addressof(info)) == 0) {
+      constexpr std::int64_t nanosInSec = 1000000000;
+      result[i].size = info.st_size;
+      result[i].mtime = info.st_mtim.tv_sec * nanosInSec + info.st_mtim.tv_nsec;
+    }
+  }
+  return result;
+}
+
+void kizhin::DictionaryCache::save(std::ostream& out, const State& state) const
+{
+  Map< FileList, const Entry* > live{};
+  for (const auto& dict: state) {
+    const auto pos = entries_.find(dict.second);
+    if (pos != entries_.end()) {
+      live[pos->first] = std::addressof(pos->second);
+    }
+  }
+  out.write(cacheMagic, sizeof(cacheMagic));
+  writeBinary(out, cacheVersion);
+  writeBinary< std::uint64_t >(out, live.size());
+  for (const auto& item: live) {
+    const FileList& files = item.first;
+    const Entry& entry = *item.second;
+    writeBinary< std::uint64_t >(out, files.size());
+    for (std::size_t i = 0; i != files.size(); ++i) {
+      writeBinary(out, files[i]);
+      writeBinary(out, entry.stamps[i].size);
+      writeBinary(out, entry.stamps[i].mtime);
+    }
+    writeBinary< std::uint64_t >(out, entry.dict->total);
+    writeBinary< std::uint64_t >(out, entry.dict->wordMap.size());
+    for (const auto& word: entry.dict->wordMap) {
+      writeBinary(out, word.first);
+      writeBinary< std::uint64_t >(out, word.second);
+    }
+  }
+}
+
+bool kizhin::DictionaryCache::load(std::istream& in)
+{
+  char magic[sizeof(cacheMagic)] = {};
+  std::uint32_t version = 0;
+  std::uint64_t entryCount = 0;
+  in.read(magic, sizeof(magic));
+  if (!in || !std::equal(magic, magic + sizeof(magic), cacheMagic)) {
+    return false;
+  }
+  if (!readBinary(in, version) || version != cacheVersion || !readBinary(in, entryCount)) {
+    return false;
+  }
+  Map< FileList, Entry > entries{};
+  for (std::uint64_t i = 0; i != entryCount; ++i) {
+    std::uint64_t fileCount = 0;
+    if (!readBinary(in, fileCount)) {
+      return false;
+    }
+    FileList files{};
+    Entry entry{};
+    for (std::uint64_t j = 0; j != fileCount; ++j) {
+      std::string path{};
+      FileStamp stamp{};
+      if (!readBinary(in, path) || !readBinary(in, stamp.size) || !readBinary(in, stamp.mtime)) {
+        return false;
+      }
+      files.push_back(std::move(path));
+      entry.stamps.push_back(stamp);
+    }
+    std::uint64_t total = 0;
+    std::uint64_t wordCount = 0;
+    if (!readBinary(in, total) || !readBinary(in, wordCount)) {
+      return false;
+    }
+    std::vector< std::pair< std::string, std::size_t > > words{};
+    for (std::uint64_t j = 0; j != wordCount; ++j) {
+      std::string word{};
+      std::uint64_t count = 0;
+      if (!readBinary(in, word) || !readBinary(in, count)) {
+        return false;
+      }
+      if (!words.empty() && !(words.back().first < word)) {
+        return false;
+      }
+      words.emplace_back(std::move(word), count);
+    }
+    auto dict = std::make_shared< FrequencyDictionary >();
+    dict->wordMap = WordMap(sorted_unique, words.begin(), words.end());
+    for (const auto& word: words) {
+      dict->wordSet.insert(dict->wordSet.end(), word.first);
+      dict->sizeSet.insert(word);
+    }
+    dict->total = total;
+    entry.dict = std::move(dict);
+    entries[std::move(files)] = std::move(entry);
+  }
+  entries_ = std::move(entries);
+  return true;
+}
+
+kizhin::FrequencyDictionary kizhin::buildDictionary(const DictionaryCache::FileList& files)
+{
+  FrequencyDictionary result{};
+  using std::placeholders::_1;
+  const auto expander = std::bind(std::addressof(expandDictionary), _1, std::ref(result));
+  std::vector< std::ifstream > fins(files.begin(), files.end());
+  std::for_each(fins.begin(), fins.end(), expander);
+  return result;
+}
+
+template < typename T >
+void kizhin::writeBinary(std::ostream& out, const T value)
+{
+  out.write(reinterpret_cast< const char* >(std::addressof(value)), sizeof(T));
+}
+
+void kizhin::writeBinary(std::ostream& out, const std::string& str)
+{
+  writeBinary< std::uint64_t >(out, str.size());
+  out.write(str.data(), str.size());
+}
+
+template < typename T >
+bool kizhin::readBinary(std::istream& in, T& value)
+{
+  return static_cast< bool >(in.read(reinterpret_cast< char* >(std::addressof(value)), sizeof(T)));
+}
+
+bool kizhin::readBinary(std::istream& in, std::string& str)
+{
+  std::uint64_t size = 0;
+  if (!readBinary(in, size)) {
+    return false;
+  }
+  constexpr std::uint64_t maxSize = 1 << 24;
+  if (size > maxSize) {
+    return false;
+  }
+  str.resize(size);
+  return size == 0 || static_cast< bool >(in.read(std::addressof(str[0]), size));
+}
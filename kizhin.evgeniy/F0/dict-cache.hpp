@@ -0,0 +1,47 @@
+#ifndef SPBSPU_LABS_2025_TP_A_KIZHIN_EVGENIY_F0_DICT_CACHE_HPP
+#define SPBSPU_LABS_2025_TP_A_KIZHIN_EVGENIY_F0_DICT_CACHE_HPP
+
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+#include <map.hpp>
+#include "freq-dict.hpp"
+#include "state.hpp"
+#include "wildcard.hpp"
+
+namespace kizhin {
+  class DictionaryCache
+  {
+  public:
+    using FileList = std::vector< std::string >;
+
+    DictPtr get(const FileList&);
+    SuffixIndexPtr getSuffixIndex(const FileList&);
+    void save(std::ostream&, const State&) const;
+    bool load(std::istream&);
+
+  private:
+    struct FileStamp
+    {
+      std::int64_t size = -1;
+      std::int64_t mtime = 0;
+
+      bool operator==(const FileStamp&) const noexcept;
+    };
+    using Stamps = std::vector< FileStamp >;
+    struct Entry
+    {
+      Stamps stamps{};
+      DictPtr dict{};
+      SuffixIndexPtr suffixIndex{};
+    };
+
+    Map< FileList, Entry > entries_{};
+
+    static Stamps getStamps(const FileList&);
+  };
+}
+
+#endif
@@ -2,6 +2,7 @@
 #define SPBSPU_LABS_2025_TP_A_KIZHIN_EVGENIY_F0_FREQ_DICT_HPP
 
 #include <iosfwd>
+#include <memory>
 #include <set>
 #include <string>
 #include <map.hpp>
@@ -25,6 +26,7 @@ namespace kizhin {
     SizeSet sizeSet{};
     std::size_t total = 0;
   };
+  using DictPtr = std::shared_ptr< const FrequencyDictionary >;
 
   void expandDictionary(std::istream&, FrequencyDictionary&);
 }
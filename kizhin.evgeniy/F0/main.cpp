@@ -15,12 +15,18 @@ int main(int argc, char** argv)
   }
   try {
     const std::string stateFile = getStateFile();
+    const std::string cacheFile = getCacheFile();
     std::ifstream fin(stateFile);
     auto state = loadState(fin);
-    CommandProcessor cmd(state, std::cin, std::cout, std::cerr);
+    DictionaryCache cache{};
+    std::ifstream cacheIn(cacheFile, std::ios::binary);
+    cache.load(cacheIn);
+    CommandProcessor cmd(state, cache, std::cin, std::cout, std::cerr);
     cmd.processCommands();
     std::ofstream fout(stateFile);
     saveState(fout, state);
+    std::ofstream cacheOut(cacheFile, std::ios::binary);
+    cache.save(cacheOut, state);
   } catch (const std::exception& e) {
     std::cerr << "Error: " << e.what() << '\n';
     return 1;
@@ -52,6 +58,7 @@ void kizhin::outHelp(std::ostream& out, const char* exec)
   out << '\n';
   out << "State Information:" << '\n';
   out << "  Program state is automatically saved to: " << getStateFile() << '\n';
+  out << "  Parsed dictionaries are cached in: " << getCacheFile() << '\n';
   out << "  Default state directory locations:" << '\n';
   out << "    1. $XDG_STATE_HOME/freq_dict.state" << '\n';
   out << "    2. $HOME/.local/state/freq_dict.state" << '\n';
@@ -15,6 +15,11 @@ std::string kizhin::getStateFile()
   return getStateDir() + "/freq_dict.state";
 }
 
+std::string kizhin::getCacheFile()
+{
+  return getStateDir() + "/freq_dict.cache";
+}
+
 kizhin::State kizhin::loadState(std::istream& in)
 {
   State result{};
@@ -9,6 +9,7 @@
 namespace kizhin {
   using State = Map< std::string, std::vector< std::string > >;
   std::string getStateFile();
+  std::string getCacheFile();
   void saveState(std::ostream&, const State&);
   State loadState(std::istream&);
 }
@@ -0,0 +1,137 @@
+#include "wildcard.hpp"
+#include <algorithm>
+#include <iterator>
+
+namespace kizhin {
+  struct ReversedLess
+  {
+    bool operator()(const WordMap::value_type*, const std::string&) const;
+    bool operator()(const WordMap::value_type*, const WordMap::value_type*) const;
+  };
+  struct HasSuffix
+  {
+    const std::string& suffix;
+    bool operator()(const WordMap::value_type*) const;
+  };
+
+  bool reversedLess(const std::string&, const std::string&);
+  bool hasSuffix(const std::string&, const std::string&);
+  std::string nextPrefix(std::string);
+}
+
+kizhin::WildcardPattern::WildcardPattern(const std::string& pattern)
+{
+  auto start = pattern.begin();
+  while (true) {
+    const auto next = std::find(start, pattern.end(), '*');
+    parts_.emplace_back(start, next);
+    if (next == pattern.end()) {
+      break;
+    }
+    start = std::next(next);
+  }
+}
+
+bool kizhin::WildcardPattern::operator()(const std::string& str) const
+{
+  if (isLiteral()) {
+    return str == parts_.front();
+  }
+  const std::string& first = prefix();
+  const std::string& last = suffix();
+  if (str.size() < first.size() + last.size()) {
+    return false;
+  }
+  if (str.compare(0, first.size(), first) != 0 || !hasSuffix(str, last)) {
+    return false;
+  }
+  const std::size_t end = str.size() - last.size();
+  std::size_t pos = first.size();
+  for (auto part = std::next(parts_.begin()); part != std::prev(parts_.end()); ++part) {
+    pos = str.find(*part, pos);
+    if (pos == std::string::npos || pos + part->size() > end) {
+      return false;
+    }
+    pos += part->size();
+  }
+  return true;
+}
+
+bool kizhin::WildcardPattern::isLiteral() const noexcept
+{
+  return parts_.size() == 1;
+}
+
+const std::string& kizhin::WildcardPattern::prefix() const noexcept
+{
+  return parts_.front();
+}
+
+const std::string& kizhin::WildcardPattern::suffix() const noexcept
+{
+  return parts_.back();
+}
+
+kizhin::SuffixIndex::SuffixIndex(DictPtr dict):
+  dict_(std::move(dict)),
+  words_()
+{
+  const WordMap& wordMap = dict_->wordMap;
+  words_.reserve(wordMap.size());
+  const WordMap::value_type* (*addressOf)(const WordMap::value_type&) = std::addressof;
+  std::transform(wordMap.begin(), wordMap.end(), std::back_inserter(words_), addressOf);
+  std::sort(words_.begin(), words_.end(), ReversedLess{});
+}
+
+kizhin::SuffixIndex::Range kizhin::SuffixIndex::equalRange(const std::string& suffix) const
+{
+  const auto first = std::lower_bound(words_.begin(), words_.end(), suffix, ReversedLess{});
+  const auto last = std::partition_point(first, words_.end(), HasSuffix{ suffix });
+  return std::make_pair(first, last);
+}
+
+kizhin::WordMapRange kizhin::prefixRange(const WordMap& wordMap, const std::string& prefix)
+{
+  const auto first = wordMap.lowerBound(prefix);
+  const std::string upper = nextPrefix(prefix);
+  const auto last = upper.empty() ? wordMap.end() : wordMap.lowerBound(upper);
+  return std::make_pair(first, last);
+}
+
+bool kizhin::ReversedLess::operator()(const WordMap::value_type* lhs,
+    const std::string& rhs) const
+{
+  return reversedLess(lhs->first, rhs);
+}
+
+bool kizhin::ReversedLess::operator()(const WordMap::value_type* lhs,
+    const WordMap::value_type* rhs) const
+{
+  return reversedLess(lhs->first, rhs->first);
+}
+
+bool kizhin::HasSuffix::operator()(const WordMap::value_type* word) const
+{
+  return hasSuffix(word->first, suffix);
+}
+
+bool kizhin::reversedLess(const std::string& lhs, const std::string& rhs)
+{
+  return std::lexicographical_compare(lhs.rbegin(), lhs.rend(), rhs.rbegin(), rhs.rend());
+}
+
+bool kizhin::hasSuffix(const std::string& str, const std::string& suffix)
+{
+  return str.size() >= suffix.size() && std::equal(suffix.rbegin(), suffix.rend(), str.rbegin());
+}
+
+std::string kizhin::nextPrefix(std::string prefix)
+{
+  while (!prefix.empty() && static_cast< unsigned char >(prefix.back()) == 0xFF) {
+    prefix.pop_back();
+  }
+  if (!prefix.empty()) {
+    prefix.back() = static_cast< char >(static_cast< unsigned char >(prefix.back()) + 1);
+  }
+  return prefix;
+}
@@ -0,0 +1,44 @@
+#ifndef SPBSPU_LABS_2025_TP_A_KIZHIN_EVGENIY_F0_WILDCARD_HPP
+#define SPBSPU_LABS_2025_TP_A_KIZHIN_EVGENIY_F0_WILDCARD_HPP
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "freq-dict.hpp"
+
+namespace kizhin {
+  class WildcardPattern
+  {
+  public:
+    explicit WildcardPattern(const std::string&);
+    bool operator()(const std::string&) const;
+
+    bool isLiteral() const noexcept;
+    const std::string& prefix() const noexcept;
+    const std::string& suffix() const noexcept;
+
+  private:
+    std::vector< std::string > parts_;
+  };
+
+  class SuffixIndex
+  {
+  public:
+    using const_iterator = std::vector< const WordMap::value_type* >::const_iterator;
+    using Range = std::pair< const_iterator, const_iterator >;
+
+    explicit SuffixIndex(DictPtr);
+    Range equalRange(const std::string&) const;
+
+  private:
+    DictPtr dict_;
+    std::vector< const WordMap::value_type* > words_;
+  };
+  using SuffixIndexPtr = std::shared_ptr< const SuffixIndex >;
+
+  using WordMapRange = std::pair< WordMap::const_iterator, WordMap::const_iterator >;
+  WordMapRange prefixRange(const WordMap&, const std::string&);
+}
+
+#endif
@@ -4,15 +4,31 @@ std::istream& kizhin::inputSequences(std::istream& in, NamesT& names,
     ForwardList< NumbersT >& numbersLists)
 {
   NamesT::value_type currName;
-  NumbersT currNums;
   while (in >> currName) {
     names.pushBack(currName);
     using IstremIterT = std::istream_iterator< NumbersT::value_type >;
-    currNums.assign(IstremIterT(in), IstremIterT{});
-    numbersLists.pushBack(currNums);
+    numbersLists.emplaceBack(IstremIterT(in), IstremIterT{});
     in.clear();
   }
   in.clear();
   return in;
 }
 
+
+kizhin::FastReader& kizhin::inputSequences(FastReader& in, NamesT& names,
+    ForwardList< NumbersT >& numbersLists)
+{
+  NamesT::value_type currName;
+  while (in.readToken(currName)) {
+    names.pushBack(currName);
+    NumbersT currNums;
+    NumbersT::value_type number = 0;
+    while (in.readUint64(number)) {
+      currNums.pushBack(number);
+    }
+    numbersLists.pushBack(std::move(currNums));
+    in.clear();
+  }
+  in.clear();
+  return in;
+}
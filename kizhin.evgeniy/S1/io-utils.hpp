@@ -2,17 +2,19 @@
 #define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S1_IO_UTILS_HPP
 
 #include <iostream>
+#include <fast-reader.hpp>
 #include <forward-list.hpp>
 #include "type-utils.hpp"
 
 namespace kizhin {
   std::istream& inputSequences(std::istream&, NamesT&, ForwardList< NumbersT >&);
-  template < typename T >
-  std::ostream& outputList(std::ostream&, const ForwardList< T >&);
+  FastReader& inputSequences(FastReader&, NamesT&, ForwardList< NumbersT >&);
+  template < typename List >
+  std::ostream& outputList(std::ostream&, const List&);
 }
 
-template < typename T >
-std::ostream& kizhin::outputList(std::ostream& out, const ForwardList< T >& list)
+template < typename List >
+std::ostream& kizhin::outputList(std::ostream& out, const List& list)
 {
   if (list.empty()) {
     return out;
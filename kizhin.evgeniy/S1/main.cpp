@@ -1,15 +1,20 @@
 #include <algorithm>
+#include <cstring>
 #include <stdexcept>
 #include "io-utils.hpp"
 #include "list-utils.hpp"
 
-int main()
+int main(int argc, char** argv)
 {
   using namespace kizhin;
+  const bool isFastInput = argc > 1 && std::strcmp(argv[1], "--fast-input") == 0;
   try {
     NamesT names;
     ForwardList< NumbersT > numbers;
-    if (!inputSequences(std::cin, names, numbers)) {
+    if (isFastInput) {
+      FastReader in(std::cin);
+      inputSequences(in, names, numbers);
+    } else if (!inputSequences(std::cin, names, numbers)) {
       throw std::logic_error("Failed to input");
     }
     numbers = transpose(numbers);
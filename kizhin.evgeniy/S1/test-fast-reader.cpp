@@ -0,0 +1,126 @@
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <boost/test/unit_test.hpp>
+#include <fast-reader.hpp>
+
+using kizhin::FastReader;
+
+BOOST_AUTO_TEST_SUITE(fast_reader);
+
+BOOST_AUTO_TEST_CASE(read_tokens_and_numbers)
+{
+  std::istringstream in("first 1 22\n333\tsecond  -4");
+  FastReader reader(in);
+  std::string token;
+  std::uint64_t number = 0;
+  std::int64_t signedNumber = 0;
+  BOOST_TEST(reader.readToken(token));
+  BOOST_TEST(token == "first");
+  BOOST_TEST(reader.readUint64(number));
+  BOOST_TEST(number == 1);
+  BOOST_TEST(reader.readUint64(number));
+  BOOST_TEST(number == 22);
+  BOOST_TEST(reader.readUint64(number));
+  BOOST_TEST(number == 333);
+  BOOST_TEST(!reader.readUint64(number));
+  BOOST_TEST(!reader);
+  reader.clear();
+  BOOST_TEST(reader.readToken(token));
+  BOOST_TEST(token == "second");
+  BOOST_TEST(reader.readInt64(signedNumber));
+  BOOST_TEST(signedNumber == -4);
+  BOOST_TEST(!reader.readToken(token));
+  BOOST_TEST(reader.eof());
+}
+
+BOOST_AUTO_TEST_CASE(read_limits)
+{
+  std::istringstream in("18446744073709551615 9223372036854775807 -9223372036854775808");
+  FastReader reader(in);
+  std::uint64_t number = 0;
+  std::int64_t signedNumber = 0;
+  BOOST_TEST(reader.readUint64(number));
+  BOOST_TEST(number == std::numeric_limits< std::uint64_t >::max());
+  BOOST_TEST(reader.readInt64(signedNumber));
+  BOOST_TEST(signedNumber == std::numeric_limits< std::int64_t >::max());
+  BOOST_TEST(reader.readInt64(signedNumber));
+  BOOST_TEST(signedNumber == std::numeric_limits< std::int64_t >::min());
+}
+
+BOOST_AUTO_TEST_CASE(overflow_consumes_digits)
+{
+  std::istringstream in("18446744073709551616 next 9223372036854775808");
+  FastReader reader(in);
+  std::uint64_t number = 0;
+  std::int64_t signedNumber = 0;
+  std::string token;
+  BOOST_TEST(!reader.readUint64(number));
+  BOOST_TEST(number == std::numeric_limits< std::uint64_t >::max());
+  reader.clear();
+  BOOST_TEST(reader.readToken(token));
+  BOOST_TEST(token == "next");
+  BOOST_TEST(!reader.readInt64(signedNumber));
+  BOOST_TEST(signedNumber == std::numeric_limits< std::int64_t >::max());
+}
+
+BOOST_AUTO_TEST_CASE(format_errors_match_stream)
+{
+  const std::string text = "12ab -1 + 5 -x";
+  std::istringstream expectedIn(text);
+  std::istringstream in(text);
+  FastReader reader(in);
+  for (int i = 0; i != 6; ++i) {
+    std::uint64_t expected = 1;
+    std::uint64_t number = 1;
+    const bool isRead = static_cast< bool >(expectedIn >> expected);
+    BOOST_TEST(reader.readUint64(number) == isRead);
+    BOOST_TEST(number == expected);
+    std::string expectedToken;
+    std::string token;
+    expectedIn.clear();
+    reader.clear();
+    if (!isRead && expectedIn >> expectedToken) {
+      BOOST_TEST(reader.readToken(token));
+      BOOST_TEST(token == expectedToken);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(values_across_buffer_refills)
+{
+  std::istringstream in("  12345678901234567 alpha_beta_gamma 42");
+  FastReader reader(in, 3);
+  std::uint64_t number = 0;
+  std::string token;
+  BOOST_TEST(reader.readUint64(number));
+  BOOST_TEST(number == 12345678901234567ULL);
+  BOOST_TEST(reader.readToken(token));
+  BOOST_TEST(token == "alpha_beta_gamma");
+  BOOST_TEST(reader.readUint64(number));
+  BOOST_TEST(number == 42);
+}
+
+BOOST_AUTO_TEST_CASE(read_from_descriptor)
+{
+  int fds[2] = {};
+  BOOST_REQUIRE(::pipe(fds) == 0);
+  const std::string text = "name 7 8";
+  BOOST_REQUIRE(::write(fds[1], text.data(), text.size()) == static_cast< ssize_t >(text.size()));
+  ::close(fds[1]);
+  FastReader reader(fds[0]);
+  std::string token;
+  std::uint64_t number = 0;
+  BOOST_TEST(reader.readToken(token));
+  BOOST_TEST(token == "name");
+  BOOST_TEST(reader.readUint64(number));
+  BOOST_TEST(number == 7);
+  BOOST_TEST(reader.readUint64(number));
+  BOOST_TEST(number == 8);
+  BOOST_TEST(!reader.readUint64(number));
+  ::close(fds[0]);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
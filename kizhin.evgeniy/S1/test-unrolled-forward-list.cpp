@@ -0,0 +1,246 @@
+#include <boost/test/unit_test_suite.hpp>
+#include "test-utils.hpp"
+
+using kizhin::UnrolledListT;
+
+namespace {
+  UnrolledListT makeSequence(UnrolledListT::size_type size)
+  {
+    UnrolledListT result;
+    for (UnrolledListT::size_type i = 0; i != size; ++i) {
+      result.pushBack(i);
+    }
+    return result;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(unrolled_forward_list);
+
+BOOST_AUTO_TEST_CASE(unrolled_default_constructor)
+{
+  const UnrolledListT list;
+  testForwardListInvariants(list);
+  BOOST_TEST(list.empty());
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_copy_constructor)
+{
+  const UnrolledListT list = makeSequence(11);
+  const UnrolledListT copied(list);
+  testForwardListInvariants(copied);
+  BOOST_TEST(copied == list);
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_move_constructor)
+{
+  UnrolledListT list = makeSequence(11);
+  const UnrolledListT copied(list);
+  const UnrolledListT moved(std::move(list));
+  testForwardListInvariants(moved);
+  testForwardListInvariants(list);
+  BOOST_TEST(moved == copied);
+  BOOST_TEST(list.empty());
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_move_assignment_operator)
+{
+  UnrolledListT list = makeSequence(9);
+  const UnrolledListT copied(list);
+  UnrolledListT assigned{ 1, 2 };
+  assigned = std::move(list);
+  testForwardListInvariants(assigned);
+  BOOST_TEST(assigned == copied);
+  list.pushBack(1);
+  testForwardListInvariants(list);
+  BOOST_TEST(list.size() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_push_back_across_blocks)
+{
+  const UnrolledListT list = makeSequence(13);
+  testForwardListInvariants(list);
+  BOOST_TEST(list.size() == 13);
+  BOOST_TEST(list.front() == 0);
+  BOOST_TEST(list.back() == 12);
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_push_front_across_blocks)
+{
+  const UnrolledListT expected{ 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+  UnrolledListT list;
+  for (int i = 0; i != 10; ++i) {
+    list.pushFront(i);
+  }
+  testForwardListInvariants(list);
+  BOOST_TEST(list == expected);
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_emplace_after_full_block)
+{
+  const UnrolledListT expected{ 0, 1, 10, 2, 3, 4, 5 };
+  UnrolledListT list = makeSequence(6);
+  UnrolledListT::iterator result = list.emplaceAfter(std::next(list.begin()), 10);
+  testForwardListInvariants(list);
+  BOOST_TEST(list == expected);
+  BOOST_TEST((result == std::next(list.begin(), 2)));
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_emplace_after_block_end)
+{
+  const UnrolledListT expected{ 0, 1, 2, 3, 10, 4, 5 };
+  UnrolledListT list = makeSequence(6);
+  UnrolledListT::iterator result = list.emplaceAfter(std::next(list.begin(), 3), 10);
+  testForwardListInvariants(list);
+  BOOST_TEST(list == expected);
+  BOOST_TEST((result == std::next(list.begin(), 4)));
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_pop_back_and_front)
+{
+  const UnrolledListT expected{ 2, 3, 4, 5, 6 };
+  UnrolledListT list = makeSequence(9);
+  list.popFront();
+  list.popFront();
+  list.popBack();
+  list.popBack();
+  testForwardListInvariants(list);
+  BOOST_TEST(list == expected);
+  list.popBack();
+  list.popBack();
+  list.popBack();
+  list.popFront();
+  list.popFront();
+  testForwardListInvariants(list);
+  BOOST_TEST(list.empty());
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_erase_after_across_blocks)
+{
+  const UnrolledListT expected{ 0, 1, 9, 10 };
+  UnrolledListT list = makeSequence(11);
+  UnrolledListT::iterator result = list.eraseAfter(std::next(list.begin()),
+      std::next(list.begin(), 9));
+  testForwardListInvariants(list);
+  BOOST_TEST(list == expected);
+  BOOST_TEST((result == std::next(list.begin())));
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_erase_after_with_end)
+{
+  const UnrolledListT expected{ 0, 1, 2, 3, 4 };
+  UnrolledListT list = makeSequence(11);
+  list.eraseAfter(std::next(list.begin(), 4), list.end());
+  testForwardListInvariants(list);
+  BOOST_TEST(list == expected);
+  list.pushBack(5);
+  BOOST_TEST(list.back() == 5);
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_insert_after_range)
+{
+  const UnrolledListT expected{ 0, 1, 2, 10, 11, 12, 13, 14, 15, 3, 4 };
+  const UnrolledListT inserted{ 10, 11, 12, 13, 14, 15 };
+  UnrolledListT list = makeSequence(5);
+  UnrolledListT::iterator result = list.insertAfter(std::next(list.begin(), 2),
+      inserted.begin(), inserted.end());
+  testForwardListInvariants(list);
+  BOOST_TEST(list == expected);
+  BOOST_TEST((result == std::next(list.begin(), 3)));
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_insert_after_fill_own_element)
+{
+  const UnrolledListT expected{ 0, 3, 3, 3, 3, 3, 1, 2, 3 };
+  UnrolledListT list = makeSequence(4);
+  list.insertAfter(list.begin(), 5, list.back());
+  testForwardListInvariants(list);
+  BOOST_TEST(list == expected);
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_reverse)
+{
+  UnrolledListT list = makeSequence(10);
+  UnrolledListT expected;
+  for (int i = 0; i != 10; ++i) {
+    expected.pushFront(i);
+  }
+  list.reverse();
+  testForwardListInvariants(list);
+  BOOST_TEST(list == expected);
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_splice_after)
+{
+  const UnrolledListT expectedFirst{ 0, 6 };
+  const UnrolledListT expectedSecond{ 10, 1, 2, 3, 4, 5, 11, 12 };
+  UnrolledListT first = makeSequence(7);
+  UnrolledListT second{ 10, 11, 12 };
+  second.spliceAfter(second.begin(), first, first.begin(), std::next(first.begin(), 6));
+  testForwardListInvariants(first);
+  testForwardListInvariants(second);
+  BOOST_TEST(first == expectedFirst);
+  BOOST_TEST(second == expectedSecond);
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_splice_after_whole_into_empty)
+{
+  UnrolledListT list;
+  UnrolledListT source = makeSequence(6);
+  const UnrolledListT expected(source);
+  list.spliceAfter(list.beforeBegin(), source);
+  testForwardListInvariants(list);
+  testForwardListInvariants(source);
+  BOOST_TEST(list == expected);
+  BOOST_TEST(source.empty());
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_remove_if_drops_blocks)
+{
+  const UnrolledListT expected{ 1, 3, 5, 7, 9, 11 };
+  UnrolledListT list = makeSequence(12);
+  auto pred = [](UnrolledListT::const_reference v) -> bool
+  {
+    return static_cast< int >(v) % 2 == 0;
+  };
+  list.removeIf(pred);
+  testForwardListInvariants(list);
+  BOOST_TEST(list == expected);
+  list.remove(1);
+  list.remove(3);
+  list.remove(5);
+  list.remove(7);
+  testForwardListInvariants(list);
+  BOOST_TEST(list.size() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_unique_across_blocks)
+{
+  UnrolledListT list{ 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 1, 1 };
+  const UnrolledListT expected{ 1, 2, 3, 1 };
+  list.unique();
+  testForwardListInvariants(list);
+  BOOST_TEST(list == expected);
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_merge)
+{
+  UnrolledListT list{ 1, 3, 5, 7, 9, 11 };
+  UnrolledListT source{ 2, 4, 6, 8 };
+  const UnrolledListT expected{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 11 };
+  list.merge(source);
+  testForwardListInvariants(list);
+  testForwardListInvariants(source);
+  BOOST_TEST(list == expected);
+  BOOST_TEST(source.empty());
+}
+
+BOOST_AUTO_TEST_CASE(unrolled_sort)
+{
+  UnrolledListT list{ 3, 5, 7, 6, 8, 2, 1, 4, 9, 0 };
+  const UnrolledListT expected = makeSequence(10);
+  list.sort();
+  testForwardListInvariants(list);
+  BOOST_TEST(list == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -3,12 +3,14 @@
 
 #include <boost/test/unit_test.hpp>
 #include <forward-list.hpp>
+#include <unrolled-forward-list.hpp>
 
 namespace kizhin {
   using ListT = ForwardList< double >;
+  using UnrolledListT = UnrolledForwardList< double, 4 >;
   void testForwardListInvariants(const ListT&);
+  void testForwardListInvariants(const UnrolledListT&);
   void testComparisonInvariants(const ListT&, const ListT&);
 }
 
 #endif
-
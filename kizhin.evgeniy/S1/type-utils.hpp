@@ -4,9 +4,10 @@
 #include <cstdint>
 #include <iosfwd>
 #include <forward-list.hpp>
+#include <unrolled-forward-list.hpp>
 
 namespace kizhin {
-  using NumbersT = ForwardList< std::uint64_t >;
+  using NumbersT = UnrolledForwardList< std::uint64_t >;
   using NamesT = ForwardList< std::string >;
 }
 
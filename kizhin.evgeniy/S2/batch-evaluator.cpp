@@ -0,0 +1,97 @@
+#include "batch-evaluator.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include "io-utils.hpp"
+
+namespace kizhin {
+  void updateMinimum(std::atomic< std::size_t >&, std::size_t) noexcept;
+}
+
+kizhin::ExpressionEvaluator::number_type kizhin::ExpressionEvaluator::evaluate(
+    const std::string& line)
+{
+  in_.clear();
+  in_.str(line);
+  expression_.clear();
+  inputPostfixTokens(in_, expression_, operations_);
+  return evaluatePostfix(expression_, operands_);
+}
+
+constexpr kizhin::BatchEvaluator::size_type kizhin::BatchEvaluator::chunkSize;
+
+kizhin::BatchEvaluator::BatchEvaluator(const size_type threads):
+  threads_(std::max< size_type >(threads, 1)),
+  evaluators_(new ExpressionEvaluator[threads_])
+{}
+
+kizhin::BatchEvaluator::size_type kizhin::BatchEvaluator::threads() const noexcept
+{
+  return threads_;
+}
+
+void kizhin::BatchEvaluator::evaluate(const Buffer< std::string >& lines,
+    Buffer< number_type >& results)
+{
+  const size_type size = lines.size();
+  const size_type chunks = (size + chunkSize - 1) / chunkSize;
+  const size_type workers = std::min(threads_, chunks);
+  results.assign(size);
+  if (workers == 0) {
+    return;
+  }
+  std::atomic< size_type > nextChunk(0);
+  std::atomic< size_type > failedLine(size);
+  std::unique_ptr< std::exception_ptr[] > errors(new std::exception_ptr[workers]);
+  std::unique_ptr< size_type[] > errorLines(new size_type[workers]);
+  auto work = [&](const size_type worker)
+  {
+    ExpressionEvaluator& evaluator = evaluators_[worker];
+    errorLines[worker] = size;
+    for (size_type chunk = nextChunk++; chunk < chunks; chunk = nextChunk++) {
+      const size_type first = chunk * chunkSize;
+      if (first > failedLine.load()) {
+        return;
+      }
+      const size_type last = std::min(first + chunkSize, size);
+      for (size_type i = first; i != last; ++i) {
+        try {
+          results.begin()[i] = evaluator.evaluate(lines.begin()[i]);
+        } catch (...) {
+          errors[worker] = std::current_exception();
+          errorLines[worker] = i;
+          updateMinimum(failedLine, i);
+          return;
+        }
+      }
+    }
+  };
+  std::unique_ptr< std::thread[] > pool(new std::thread[workers - 1]);
+  size_type started = 0;
+  try {
+    for (; started != workers - 1; ++started) {
+      pool[started] = std::thread(work, started + 1);
+    }
+  } catch (const std::system_error&) {}
+  work(0);
+  for (size_type i = 0; i != started; ++i) {
+    pool[i].join();
+  }
+  size_type firstError = workers;
+  for (size_type i = 0; i != started + 1; ++i) {
+    if (errors[i] && (firstError == workers || errorLines[i] < errorLines[firstError])) {
+      firstError = i;
+    }
+  }
+  if (firstError != workers) {
+    std::rethrow_exception(errors[firstError]);
+  }
+}
+
+void kizhin::updateMinimum(std::atomic< std::size_t >& value, const std::size_t bound) noexcept
+{
+  std::size_t current = value.load();
+  while (bound < current && !value.compare_exchange_weak(current, bound)) {}
+}
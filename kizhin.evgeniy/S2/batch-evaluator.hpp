@@ -0,0 +1,56 @@
+#ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S2_BATCH_EVALUATOR_HPP
+#define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S2_BATCH_EVALUATOR_HPP
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <buffer.hpp>
+#include <queue.hpp>
+#include <stack.hpp>
+#include "postfix-expression.hpp"
+
+namespace kizhin {
+  class ExpressionEvaluator;
+  class BatchEvaluator;
+}
+
+class kizhin::ExpressionEvaluator final
+{
+public:
+  using number_type = PostfixExpression::number_type;
+
+  number_type evaluate(const std::string&);
+
+private:
+  std::istringstream in_;
+  Stack< Token > operations_;
+  Queue< Token > expression_;
+  Stack< number_type > operands_;
+};
+
+/*
+ * Evaluates independent infix expressions, one per line, on a pool of
+ * threads. Lines are handed out in chunks and every thread keeps its own
+ * evaluation buffers. Results are stored in line order, and if any line
+ * fails, the exception of the first failed line is rethrown, as sequential
+ * evaluation would do.
+ */
+class kizhin::BatchEvaluator final
+{
+public:
+  using number_type = ExpressionEvaluator::number_type;
+  using size_type = std::size_t;
+
+  static constexpr size_type chunkSize = 512;
+
+  explicit BatchEvaluator(size_type);
+
+  size_type threads() const noexcept;
+  void evaluate(const Buffer< std::string >&, Buffer< number_type >&);
+
+private:
+  size_type threads_;
+  std::unique_ptr< ExpressionEvaluator[] > evaluators_;
+};
+
+#endif
@@ -59,14 +59,22 @@ std::istream& kizhin::operator>>(std::istream& in, Token& token)
 }
 
 kizhin::PostfixExpression kizhin::inputPostfixExpression(std::istream& in)
+{
+  Stack< Token > operations;
+  Queue< Token > expression;
+  inputPostfixTokens(in, expression, operations);
+  return PostfixExpression(std::move(expression));
+}
+
+std::istream& kizhin::inputPostfixTokens(std::istream& in, Queue< Token >& expression,
+    Stack< Token >& operations)
 {
   StreamGuard guard(in);
   std::istream::sentry s(in);
   if (!s) {
-    return PostfixExpression(Queue< Token >());
+    return in;
   }
-  Stack< Token > operations;
-  Queue< Token > expression;
+  operations.clear();
   Token token;
   while (in >> token) {
     if (token.type() == TokenType::number) {
@@ -102,7 +110,7 @@ kizhin::PostfixExpression kizhin::inputPostfixExpression(std::istream& in)
     expression.push(operations.top());
     operations.pop();
   }
-  return PostfixExpression(expression);
+  return in;
 }
 
 kizhin::Token kizhin::constructToken(const char symbol)
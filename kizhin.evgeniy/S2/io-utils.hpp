@@ -2,11 +2,14 @@
 #define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S2_IO_UTILS_HPP
 
 #include <ios>
+#include <queue.hpp>
+#include <stack.hpp>
 #include "postfix-expression.hpp"
 
 namespace kizhin {
   std::istream& operator>>(std::istream&, Token&);
   PostfixExpression inputPostfixExpression(std::istream&);
+  std::istream& inputPostfixTokens(std::istream&, Queue< Token >&, Stack< Token >&);
   class StreamGuard;
 }
 
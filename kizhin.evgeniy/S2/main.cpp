@@ -1,10 +1,10 @@
 #include <fstream>
 #include <iostream>
-#include <sstream>
 #include <stdexcept>
+#include <thread>
+#include <buffer.hpp>
 #include <forward-list.hpp>
-#include "io-utils.hpp"
-#include "postfix-expression.hpp"
+#include "batch-evaluator.hpp"
 
 int main(int argc, char** argv)
 {
@@ -23,12 +23,23 @@ int main(int argc, char** argv)
       }
     }
     std::istream& in = fin.is_open() ? fin : std::cin;
+    using number_type = BatchEvaluator::number_type;
+    BatchEvaluator evaluator(std::thread::hardware_concurrency());
+    const std::size_t batchSize = evaluator.threads() * BatchEvaluator::chunkSize * 8;
+    Buffer< std::string > lines;
+    Buffer< number_type > batchResults;
+    ForwardList< number_type > results;
     std::string current;
-    ForwardList< PostfixExpression::number_type > results;
-    while (std::getline(in, current)) {
-      if (!current.empty()) {
-        std::stringstream stream(current);
-        results.pushFront(inputPostfixExpression(stream).evaluate());
+    while (in) {
+      lines.clear();
+      while (lines.size() != batchSize && std::getline(in, current)) {
+        if (!current.empty()) {
+          lines.pushBack(std::move(current));
+        }
+      }
+      evaluator.evaluate(lines, batchResults);
+      for (const number_type result: batchResults) {
+        results.pushFront(result);
       }
     }
     if (!results.empty()) {
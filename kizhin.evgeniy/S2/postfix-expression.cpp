@@ -46,30 +46,8 @@ bool kizhin::PostfixExpression::empty() const noexcept
 
 kizhin::PostfixExpression::number_type kizhin::PostfixExpression::evaluate() const
 {
-  Queue< Token > tokens = tokens_;
   Stack< number_type > operands;
-  while (!tokens.empty()) {
-    const Token token = tokens.front();
-    tokens.pop();
-    if (token.type() == TokenType::number) {
-      operands.push(token.number());
-    } else if (token.type() == TokenType::operation) {
-      if (operands.size() < 2) {
-        throw std::logic_error("Not enough operands");
-      }
-      const number_type right = operands.top();
-      operands.pop();
-      const number_type left = operands.top();
-      operands.pop();
-      operands.push(token.operation()->eval(left, right));
-    } else {
-      throw std::logic_error("Unexpected token type");
-    }
-  }
-  if (operands.size() != 1) {
-    throw std::logic_error("Invalid expression");
-  }
-  return operands.top();
+  return evaluatePostfix(tokens_, operands);
 }
 
 void kizhin::PostfixExpression::clear() noexcept
@@ -98,3 +76,28 @@ void kizhin::PostfixExpression::appendExpression(const PostfixExpression& rhs,
   swap(newTokens, tokens_);
 }
 
+kizhin::Token::number_type kizhin::evaluatePostfix(const Queue< Token >& tokens,
+    Stack< Token::number_type >& operands)
+{
+  operands.clear();
+  for (const Token& token: tokens.container()) {
+    if (token.type() == TokenType::number) {
+      operands.push(token.number());
+    } else if (token.type() == TokenType::operation) {
+      if (operands.size() < 2) {
+        throw std::logic_error("Not enough operands");
+      }
+      const Token::number_type right = operands.top();
+      operands.pop();
+      const Token::number_type left = operands.top();
+      operands.pop();
+      operands.push(token.operation()->eval(left, right));
+    } else {
+      throw std::logic_error("Unexpected token type");
+    }
+  }
+  if (operands.size() != 1) {
+    throw std::logic_error("Invalid expression");
+  }
+  return operands.top();
+}
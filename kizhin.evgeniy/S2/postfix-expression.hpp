@@ -2,6 +2,7 @@
 #define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S2_POSTFIX_EXPRESSION_HPP
 
 #include <queue.hpp>
+#include <stack.hpp>
 #include "token.hpp"
 
 namespace kizhin {
@@ -11,6 +12,8 @@ namespace kizhin {
   PostfixExpression operator-(const PostfixExpression&, const PostfixExpression&);
   PostfixExpression operator*(const PostfixExpression&, const PostfixExpression&);
   PostfixExpression operator/(const PostfixExpression&, const PostfixExpression&);
+
+  Token::number_type evaluatePostfix(const Queue< Token >&, Stack< Token::number_type >&);
 }
 
 class kizhin::PostfixExpression final
@@ -0,0 +1,92 @@
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <boost/test/unit_test.hpp>
+#include "batch-evaluator.hpp"
+#include "io-utils.hpp"
+
+using kizhin::BatchEvaluator;
+using LinesT = kizhin::Buffer< std::string >;
+using ResultsT = kizhin::Buffer< BatchEvaluator::number_type >;
+
+namespace {
+  LinesT makeLines(std::size_t size)
+  {
+    LinesT result;
+    for (std::size_t i = 0; i != size; ++i) {
+      result.pushBack(std::to_string(i) + " * ( " + std::to_string(i % 7) + " + 1 ) - 3");
+    }
+    return result;
+  }
+
+  ResultsT evaluateSequential(const LinesT& lines)
+  {
+    ResultsT result;
+    for (const std::string& line: lines) {
+      std::istringstream in(line);
+      result.pushBack(kizhin::inputPostfixExpression(in).evaluate());
+    }
+    return result;
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(batch_evaluator);
+
+BOOST_AUTO_TEST_CASE(empty_batch)
+{
+  BatchEvaluator evaluator(4);
+  ResultsT results{ 1, 2, 3 };
+  evaluator.evaluate(LinesT(), results);
+  BOOST_TEST(results.empty());
+}
+
+BOOST_AUTO_TEST_CASE(results_keep_line_order)
+{
+  const LinesT lines = makeLines(BatchEvaluator::chunkSize * 5 + 3);
+  const ResultsT expected = evaluateSequential(lines);
+  for (std::size_t threads = 1; threads != 5; ++threads) {
+    BatchEvaluator evaluator(threads);
+    ResultsT results;
+    evaluator.evaluate(lines, results);
+    BOOST_TEST((results == expected));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(evaluator_is_reusable)
+{
+  BatchEvaluator evaluator(3);
+  const LinesT first{ "1 + 2 * 3", "( 1 + 2 ) * 3", "7 % 4" };
+  const LinesT second{ "10 / ( 2 + 3 )", "(-4) - 1" };
+  ResultsT results;
+  evaluator.evaluate(first, results);
+  BOOST_TEST((results == ResultsT{ 7, 9, 3 }));
+  evaluator.evaluate(second, results);
+  BOOST_TEST((results == ResultsT{ 2, -5 }));
+}
+
+BOOST_AUTO_TEST_CASE(first_failed_line_is_reported)
+{
+  LinesT lines = makeLines(BatchEvaluator::chunkSize * 6);
+  lines.begin()[BatchEvaluator::chunkSize * 4 + 1] = "1 +";
+  lines.begin()[BatchEvaluator::chunkSize * 2 + 7] = "5 / 0";
+  lines.begin()[BatchEvaluator::chunkSize * 3] = "( 2 * )";
+  BatchEvaluator evaluator(4);
+  ResultsT results;
+  std::string message;
+  try {
+    evaluator.evaluate(lines, results);
+  } catch (const std::exception& e) {
+    message = e.what();
+  }
+  std::string expected;
+  try {
+    std::istringstream in("5 / 0");
+    kizhin::inputPostfixExpression(in).evaluate();
+  } catch (const std::exception& e) {
+    expected = e.what();
+  }
+  BOOST_TEST(!expected.empty());
+  BOOST_TEST(message == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -1,12 +1,15 @@
 #include "command-processor.hpp"
 #include <functional>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <map>
 #include <stdexcept>
+#include <buffer.hpp>
 #include "io-utils.hpp"
 
 namespace kizhin {
+  Dataset mergeDatasets(const Dataset&, const Dataset&, bool lhsOnly, bool both, bool rhsOnly);
   void print(const DSContainer&, std::istream&, std::ostream&);
   void complement(DSContainer&, std::istream&);
   void intersect(DSContainer&, std::istream&);
@@ -62,13 +65,8 @@ void kizhin::complement(DSContainer& datasets, std::istream& in)
   }
   const auto& ds1 = datasets.at(name1);
   const auto& ds2 = datasets.at(name2);
-  Dataset result;
-  for (const auto& p: ds1) {
-    if (!ds2.count(p.first)) {
-      result[p.first] = p.second;
-    }
-  }
-  datasets[newName] = result;
+  Dataset result = mergeDatasets(ds1, ds2, true, false, false);
+  datasets[newName] = std::move(result);
 }
 
 void kizhin::intersect(DSContainer& datasets, std::istream& in)
@@ -81,18 +79,12 @@ void kizhin::intersect(DSContainer& datasets, std::istream& in)
   }
   const auto& ds1 = datasets.at(name1);
   const auto& ds2 = datasets.at(name2);
-  Dataset result;
-  for (const auto& p: ds1) {
-    if (ds2.count(p.first)) {
-      result[p.first] = p.second;
-    }
-  }
-  datasets[newName] = result;
+  Dataset result = mergeDatasets(ds1, ds2, false, true, false);
+  datasets[newName] = std::move(result);
 }
 
 void kizhin::unionCmd(DSContainer& datasets, std::istream& in)
 {
-
   DSContainer::key_type newName;
   DSContainer::key_type name1;
   DSContainer::key_type name2;
@@ -101,12 +93,39 @@ void kizhin::unionCmd(DSContainer& datasets, std::istream& in)
   }
   const auto& ds1 = datasets.at(name1);
   const auto& ds2 = datasets.at(name2);
-  Dataset result = ds1;
-  for (const auto& p: ds2) {
-    if (!result.count(p.first)) {
-      result[p.first] = p.second;
+  Dataset result = mergeDatasets(ds1, ds2, true, true, true);
+  datasets[newName] = std::move(result);
+}
+
+
+kizhin::Dataset kizhin::mergeDatasets(const Dataset& lhs, const Dataset& rhs,
+    const bool lhsOnly, const bool both, const bool rhsOnly)
+{
+  Buffer< Dataset::value_type > merged;
+  const auto comp = lhs.keyComp();
+  auto lhsIt = lhs.begin();
+  auto rhsIt = rhs.begin();
+  const auto lhsEnd = lhs.end();
+  const auto rhsEnd = rhs.end();
+  while (lhsIt != lhsEnd || rhsIt != rhsEnd) {
+    if (rhsIt == rhsEnd || (lhsIt != lhsEnd && comp(lhsIt->first, rhsIt->first))) {
+      if (lhsOnly) {
+        merged.pushBack(*lhsIt);
+      }
+      ++lhsIt;
+    } else if (lhsIt == lhsEnd || comp(rhsIt->first, lhsIt->first)) {
+      if (rhsOnly) {
+        merged.pushBack(*rhsIt);
+      }
+      ++rhsIt;
+    } else {
+      if (both) {
+        merged.pushBack(*lhsIt);
+      }
+      ++lhsIt;
+      ++rhsIt;
     }
   }
-  datasets[newName] = result;
+  using MoveIt = std::move_iterator< Buffer< Dataset::value_type >::iterator >;
+  return Dataset(sorted_unique, MoveIt(merged.begin()), MoveIt(merged.end()), comp);
 }
-
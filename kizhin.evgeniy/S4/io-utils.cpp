@@ -29,6 +29,28 @@ std::istream& kizhin::operator>>(std::istream& in, DSContainer& dest)
   return in;
 }
 
+bool kizhin::inputDatasets(FastReader& in, DSContainer& dest)
+{
+  DSContainer input;
+  DSContainer::key_type key;
+  while (in.readToken(key)) {
+    Dataset::key_type dataKey{};
+    Dataset::mapped_type dataVal{};
+    Dataset dataset;
+    while (in.readInteger(dataKey) && in.readToken(dataVal)) {
+      dataset.emplace(std::move(dataKey), std::move(dataVal));
+    }
+    in.clear();
+    input.emplace(std::move(key), std::move(dataset));
+  }
+  if (input.empty()) {
+    return false;
+  }
+  in.clear();
+  dest = input;
+  return true;
+}
+
 std::ostream& kizhin::operator<<(std::ostream& out, DSContainer::const_reference data)
 {
   std::ostream::sentry sentry(out);
@@ -1,3 +1,4 @@
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <stdexcept>
@@ -6,11 +7,12 @@
 
 int main(int argc, char** argv)
 {
-  if (argc != 2 || argv[1][0] == '\0') {
-    std::cerr << "Usage: " << argv[0] << " <filename>\n";
+  const bool isFastInput = argc == 3 && std::strcmp(argv[1], "--fast-input") == 0;
+  if ((argc != 2 && !isFastInput) || argv[argc - 1][0] == '\0') {
+    std::cerr << "Usage: " << argv[0] << " [--fast-input] <filename>\n";
     return 1;
   }
-  const char* filename = argv[1];
+  const char* filename = argv[argc - 1];
   try {
     std::ifstream in(filename);
     if (!in.is_open()) {
@@ -19,7 +21,14 @@ int main(int argc, char** argv)
     }
     using namespace kizhin;
     DSContainer datasets;
-    if (!(in >> datasets)) {
+    bool isRead = false;
+    if (isFastInput) {
+      FastReader reader(in);
+      isRead = inputDatasets(reader, datasets);
+    } else {
+      isRead = static_cast< bool >(in >> datasets);
+    }
+    if (!isRead) {
       std::cerr << "Failed to read data from file: " + std::string(filename) << '\n';
       return 1;
     }
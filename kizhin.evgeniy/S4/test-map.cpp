@@ -82,6 +82,26 @@ BOOST_AUTO_TEST_CASE(initializer_list_constructor)
   BOOST_TEST(map.size() == init.size());
   BOOST_TEST(std::equal(map.begin(), map.end(), init.begin()));
 }
+
+BOOST_AUTO_TEST_CASE(sorted_unique_constructor)
+{
+  for (size_t count = 0; count != 100; ++count) {
+    std::vector< MapT::value_type > values;
+    for (size_t i = 0; i != count; ++i) {
+      values.emplace_back(i, std::to_string(i));
+    }
+    MapT map(kizhin::sorted_unique, values.begin(), values.end());
+    testMapInvariants(map);
+    BOOST_TEST(map.size() == count);
+    BOOST_TEST(std::equal(map.begin(), map.end(), values.begin()));
+    map[count] = "";
+    testMapInvariants(map);
+    for (size_t i = 0; i < count; i += 2) {
+      BOOST_TEST(map.erase(i) == 1);
+      testMapInvariants(map);
+    }
+  }
+}
 BOOST_AUTO_TEST_SUITE_END();
 BOOST_AUTO_TEST_SUITE(assignment_operators);
 
@@ -525,6 +545,23 @@ BOOST_AUTO_TEST_CASE(equal_range)
   BOOST_TEST((res.second == map.end()));
 }
 
+BOOST_AUTO_TEST_CASE(bounds_on_deep_tree)
+{
+  MapT map;
+  for (int i = 0; i != 1000; ++i) {
+    map.emplace(i * 2, std::to_string(i));
+  }
+  testMapInvariants(map);
+  for (int key = -1; key != 2001; ++key) {
+    const auto lower = map.lowerBound(key);
+    const auto upper = map.upperBound(key);
+    const int expectedLower = key < 0 ? 0 : (key + 1) / 2 * 2;
+    const int expectedUpper = key < 0 ? 0 : key / 2 * 2 + 2;
+    BOOST_TEST((expectedLower < 2000 ? lower->first == expectedLower : lower == map.end()));
+    BOOST_TEST((expectedUpper < 2000 ? upper->first == expectedUpper : upper == map.end()));
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END();
 BOOST_AUTO_TEST_SUITE(comparison_operators);
 
@@ -198,12 +198,11 @@ void kizhin::merge(GraphContainer& graphs, std::istream& in)
     throw std::logic_error("Falied to perform merge");
   }
   Graph result = graphs[firstSrc];
-  for (const auto& edge: graphs[secondSrc]) {
-    const VertexPair& vertexes = edge.first;
+  const Graph& second = graphs[secondSrc];
+  for (const auto& edge: second) {
     const WeightContiner& weights = edge.second;
-    result[vertexes].insert(weights.begin(), weights.end());
+    result[second.getVertices(edge.first)].insert(weights.begin(), weights.end());
   }
-  result.insert(graphs[secondSrc].begin(), graphs[secondSrc].end());
   graphs[dest] = std::move(result);
 }
 
@@ -226,14 +225,7 @@ void kizhin::extract(GraphContainer& graphs, std::istream& in)
   if (vertexes.size() != vertexCount) {
     throw std::logic_error("Failed to input vertexes");
   }
-  Graph result{};
-  const Graph& src = graphs[srcName];
-  for (const auto& edge: src) {
-    const VertexPair& srcVertexes = edge.first;
-    if (vertexes.count(srcVertexes.from) && vertexes.count(srcVertexes.to)) {
-      result.insert(edge);
-    }
-  }
+  Graph result = extractSubgraph(graphs[srcName], vertexes);
   graphs.insert({ std::move(dest), std::move(result) });
 }
 
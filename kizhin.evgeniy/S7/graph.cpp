@@ -1,40 +1,7 @@
 #include "graph.hpp"
-#include <algorithm>
+#include <limits>
+#include <stdexcept>
 #include <tuple>
-#include <boost/hash2/fnv1a.hpp>
-#include <boost/hash2/hash_append.hpp>
-
-namespace kizhin {
-  struct VertexEdgeFrom
-  {
-    Vertex lhs{};
-    bool operator()(Graph::const_reference rhs) const
-    {
-      const VertexPair& vertexes = rhs.first;
-      return lhs == vertexes.from;
-    }
-  };
-
-  struct VertexEdgeTo
-  {
-    Vertex lhs{};
-    bool operator()(Graph::const_reference rhs) const
-    {
-      const VertexPair& vertexes = rhs.first;
-      return lhs == vertexes.to;
-    }
-  };
-}
-
-std::size_t std::hash< kizhin::VertexPair >::operator()(
-    const kizhin::VertexPair& value) const
-{
-  namespace hash2 = boost::hash2;
-  hash2::fnv1a_64 hasher;
-  hash2::hash_append(hasher, {}, value.from);
-  hash2::hash_append(hasher, {}, value.to);
-  return hash2::get_integral_result< size_t >(hasher);
-}
 
 bool kizhin::operator==(const VertexPair& lhs, const VertexPair& rhs)
 {
@@ -48,13 +15,161 @@ bool kizhin::operator<(const VertexPair& lhs, const VertexPair& rhs)
   return lhsTuple < rhsTuple;
 }
 
+bool kizhin::Graph::empty() const noexcept
+{
+  return edges_.empty();
+}
+
+std::size_t kizhin::Graph::size() const noexcept
+{
+  return edges_.size();
+}
+
+std::size_t kizhin::Graph::vertexCount() const noexcept
+{
+  return names_.size();
+}
+
+kizhin::Graph::iterator kizhin::Graph::begin() noexcept
+{
+  return edges_.begin();
+}
+
+kizhin::Graph::iterator kizhin::Graph::end() noexcept
+{
+  return edges_.end();
+}
+
+kizhin::Graph::const_iterator kizhin::Graph::begin() const noexcept
+{
+  return edges_.begin();
+}
+
+kizhin::Graph::const_iterator kizhin::Graph::end() const noexcept
+{
+  return edges_.end();
+}
+
+kizhin::WeightContiner& kizhin::Graph::operator[](const VertexPair& vertexes)
+{
+  const VertexId from = intern(vertexes.from);
+  const VertexId to = intern(vertexes.to);
+  auto inserted = edges_.emplace(pack(from, to), WeightContiner{});
+  if (inserted.second) {
+    ++incidence_[from];
+    ++incidence_[to];
+  }
+  return inserted.first->second;
+}
+
+kizhin::Graph::iterator kizhin::Graph::find(const VertexPair& vertexes)
+{
+  EdgeKey key{};
+  return findKey(vertexes, key) ? edges_.find(key) : edges_.end();
+}
+
+kizhin::Graph::const_iterator kizhin::Graph::find(const VertexPair& vertexes) const
+{
+  EdgeKey key{};
+  return findKey(vertexes, key) ? edges_.find(key) : edges_.end();
+}
+
+kizhin::Graph::iterator kizhin::Graph::erase(const_iterator pos)
+{
+  --incidence_[getFrom(pos->first)];
+  --incidence_[getTo(pos->first)];
+  return edges_.erase(pos);
+}
+
+bool kizhin::Graph::findId(const Vertex& name, VertexId& id) const
+{
+  auto pos = ids_.find(name);
+  if (pos == ids_.end()) {
+    return false;
+  }
+  id = pos->second;
+  return true;
+}
+
+const kizhin::Vertex& kizhin::Graph::getName(const VertexId id) const
+{
+  return names_.at(id);
+}
+
+kizhin::VertexPair kizhin::Graph::getVertices(const EdgeKey key) const
+{
+  return { getName(getFrom(key)), getName(getTo(key)) };
+}
+
+bool kizhin::Graph::isUsed(const VertexId id) const
+{
+  return incidence_.at(id) != 0;
+}
+
+kizhin::Graph::VertexId kizhin::Graph::getFrom(const EdgeKey key) noexcept
+{
+  return static_cast< VertexId >(key >> 32);
+}
+
+kizhin::Graph::VertexId kizhin::Graph::getTo(const EdgeKey key) noexcept
+{
+  return static_cast< VertexId >(key);
+}
+
+kizhin::Graph::VertexId kizhin::Graph::intern(const Vertex& name)
+{
+  if (names_.size() == std::numeric_limits< VertexId >::max()) {
+    throw std::length_error("Too many vertexes in graph");
+  }
+  auto inserted = ids_.emplace(name, static_cast< VertexId >(names_.size()));
+  const VertexId id = inserted.first->second;
+  if (!inserted.second) {
+    return id;
+  }
+  try {
+    names_.push_back(name);
+    incidence_.push_back(0);
+  } catch (...) {
+    names_.resize(id);
+    ids_.erase(inserted.first);
+    throw;
+  }
+  return id;
+}
+
+bool kizhin::Graph::findKey(const VertexPair& vertexes, EdgeKey& key) const
+{
+  VertexId from{};
+  VertexId to{};
+  if (!findId(vertexes.from, from) || !findId(vertexes.to, to)) {
+    return false;
+  }
+  key = pack(from, to);
+  return true;
+}
+
+std::size_t kizhin::Graph::EdgeHash::operator()(EdgeKey key) const noexcept
+{
+  key ^= key >> 33;
+  key *= 0xFF51AFD7ED558CCDull;
+  key ^= key >> 33;
+  key *= 0xC4CEB9FE1A85EC53ull;
+  key ^= key >> 33;
+  return static_cast< std::size_t >(key);
+}
+
+kizhin::Graph::EdgeKey kizhin::Graph::pack(const VertexId from, const VertexId to) noexcept
+{
+  return (static_cast< EdgeKey >(from) << 32) | to;
+}
+
 kizhin::VertexContainer kizhin::getVertices(const Graph& graph)
 {
   VertexContainer result;
-  for (const auto& edge: graph) {
-    const VertexPair& vertexes = edge.first;
-    result.insert(vertexes.from);
-    result.insert(vertexes.to);
+  for (Graph::VertexId id = 0; id != graph.vertexCount(); ++id) {
+    if (graph.isUsed(id)) {
+      result.insert(result.end(), graph.getName(id));
+    }
   }
   return result;
 }
@@ -62,16 +177,47 @@ kizhin::VertexContainer kizhin::getVertices(const Graph& graph)
 kizhin::SortedGraph kizhin::getOutbound(const Graph& graph, const Vertex& vertex)
 {
   SortedGraph result;
-  auto out = std::inserter(result, result.end());
-  std::copy_if(graph.begin(), graph.end(), out, VertexEdgeFrom{ vertex });
+  Graph::VertexId id{};
+  if (!graph.findId(vertex, id)) {
+    return result;
+  }
+  for (const auto& edge: graph) {
+    if (Graph::getFrom(edge.first) == id) {
+      result.emplace(graph.getVertices(edge.first), edge.second);
+    }
+  }
   return result;
 }
 
 kizhin::SortedGraph kizhin::getInbound(const Graph& graph, const Vertex& vertex)
 {
   SortedGraph result;
-  auto out = std::inserter(result, result.end());
-  std::copy_if(graph.begin(), graph.end(), out, VertexEdgeTo{ vertex });
+  Graph::VertexId id{};
+  if (!graph.findId(vertex, id)) {
+    return result;
+  }
+  for (const auto& edge: graph) {
+    if (Graph::getTo(edge.first) == id) {
+      result.emplace(graph.getVertices(edge.first), edge.second);
+    }
+  }
   return result;
 }
 
+kizhin::Graph kizhin::extractSubgraph(const Graph& src, const VertexContainer& vertexes)
+{
+  std::vector< bool > selected(src.vertexCount(), false);
+  for (const Vertex& vertex: vertexes) {
+    Graph::VertexId id{};
+    if (src.findId(vertex, id)) {
+      selected[id] = true;
+    }
+  }
+  Graph result{};
+  for (const auto& edge: src) {
+    if (selected[Graph::getFrom(edge.first)] && selected[Graph::getTo(edge.first)]) {
+      result[src.getVertices(edge.first)] = edge.second;
+    }
+  }
+  return result;
+}
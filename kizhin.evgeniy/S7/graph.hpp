@@ -1,9 +1,11 @@
 #ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S7_GRAPH_HPP
 #define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_S7_GRAPH_HPP
 
+#include <cstdint>
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 #include <unordered-map.hpp>
 
 namespace kizhin {
@@ -13,31 +15,66 @@ namespace kizhin {
     Vertex from{};
     Vertex to{};
   };
-}
-
-namespace std {
-  template <>
-  struct hash< kizhin::VertexPair >
-  {
-    size_t operator()(const kizhin::VertexPair&) const;
-  };
-}
 
-namespace kizhin {
   using Weight = std::size_t;
   using WeightContiner = std::multiset< Weight >;
 
   bool operator==(const VertexPair&, const VertexPair&);
   bool operator<(const VertexPair&, const VertexPair&);
 
-  using Graph = UnorderedMap< VertexPair, WeightContiner >;
+  class Graph
+  {
+  public:
+    using VertexId = std::uint32_t;
+    using EdgeKey = std::uint64_t;
+    struct EdgeHash
+    {
+      std::size_t operator()(EdgeKey) const noexcept;
+    };
+    using EdgeMap = UnorderedMap< EdgeKey, WeightContiner, EdgeHash >;
+    using iterator = EdgeMap::iterator;
+    using const_iterator = EdgeMap::const_iterator;
+
+    bool empty() const noexcept;
+    std::size_t size() const noexcept;
+    std::size_t vertexCount() const noexcept;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    WeightContiner& operator[](const VertexPair&);
+    iterator find(const VertexPair&);
+    const_iterator find(const VertexPair&) const;
+    iterator erase(const_iterator);
+
+    bool findId(const Vertex&, VertexId&) const;
+    const Vertex& getName(VertexId) const;
+    VertexPair getVertices(EdgeKey) const;
+    bool isUsed(VertexId) const;
+
+    static VertexId getFrom(EdgeKey) noexcept;
+    static VertexId getTo(EdgeKey) noexcept;
+
+  private:
+    UnorderedMap< Vertex, VertexId > ids_{};
+    std::vector< Vertex > names_{};
+    std::vector< std::size_t > incidence_{};
+    EdgeMap edges_{};
+
+    VertexId intern(const Vertex&);
+    bool findKey(const VertexPair&, EdgeKey&) const;
+    static EdgeKey pack(VertexId, VertexId) noexcept;
+  };
+
   using VertexContainer = std::set< Vertex >;
-  using SortedGraph = std::map< Graph::key_type, Graph::mapped_type >;
+  using SortedGraph = std::map< VertexPair, WeightContiner >;
 
   VertexContainer getVertices(const Graph&);
   SortedGraph getOutbound(const Graph&, const Vertex&);
   SortedGraph getInbound(const Graph&, const Vertex&);
+  Graph extractSubgraph(const Graph&, const VertexContainer&);
 }
 
 #endif
-
@@ -227,6 +227,21 @@ BOOST_AUTO_TEST_CASE(find_missing_key)
   testUnorderedMapInvariants(map);
 }
 
+BOOST_AUTO_TEST_CASE(find_missing_key_in_filled_map)
+{
+  UnorderedMapT map;
+  for (int i = 0; i != 64; ++i) {
+    map.insert({ i, i });
+  }
+  for (int i = 0; i != 64; i += 2) {
+    map.erase(i);
+  }
+  for (int i = 0; i != 256; ++i) {
+    BOOST_TEST((map.find(i) != map.end()) == (i < 64 && i % 2 == 1));
+  }
+  testUnorderedMapInvariants(map);
+}
+
 BOOST_AUTO_TEST_CASE(count_existing_key)
 {
   const UnorderedMapT map = { { 1, 1 } };
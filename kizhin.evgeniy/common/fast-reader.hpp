@@ -0,0 +1,288 @@
+#ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_FAST_READER_HPP
+#define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_FAST_READER_HPP
+
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <unistd.h>
+
+namespace kizhin {
+  /*
+   * Buffered reader for whitespace separated input. Reads follow the rules of
+   * formatted stream extraction in the "C" locale: leading whitespace is
+   * skipped, an optional sign is accepted (and wraps for unsigned types), an
+   * out of range value consumes all of its digits and fails, and a failed read
+   * puts the reader into a failed state until clear(). The reader consumes its
+   * source in large blocks, so the source must not be read from elsewhere
+   * while the reader is in use.
+   */
+  class FastReader final
+  {
+  public:
+    using size_type = std::size_t;
+
+    static constexpr size_type defaultBufferSize = 1 << 16;
+
+    explicit FastReader(std::istream&, size_type = defaultBufferSize);
+    explicit FastReader(int, size_type = defaultBufferSize);
+
+    bool readUint64(std::uint64_t&);
+    bool readInt64(std::int64_t&);
+    template < typename Integer >
+    bool readInteger(Integer&);
+    bool readToken(std::string&);
+
+    explicit operator bool() const noexcept;
+    bool eof() const noexcept;
+    void clear() noexcept;
+
+  private:
+    std::istream* in_;
+    int fd_;
+    std::unique_ptr< char[] > buffer_;
+    size_type capacity_;
+    const char* pos_;
+    const char* end_;
+    bool failed_;
+    bool exhausted_;
+
+    bool fill();
+    bool skipSpaces();
+    bool readMagnitude(std::uint64_t&, std::uint64_t);
+  };
+
+  namespace detail {
+    inline bool isSpace(char c) noexcept
+    {
+      return c == ' ' || (c >= '\t' && c <= '\r');
+    }
+
+    inline bool isDigit(char c) noexcept
+    {
+      return c >= '0' && c <= '9';
+    }
+
+    inline std::uint64_t loadEightBytes(const char* data) noexcept
+    {
+      std::uint64_t result = 0;
+      for (int i = 7; i >= 0; --i) {
+        result = (result << 8) | static_cast< unsigned char >(data[i]);
+      }
+      return result;
+    }
+
+    inline bool isEightDigits(std::uint64_t chunk) noexcept
+    {
+      constexpr std::uint64_t high = 0xF0F0F0F0F0F0F0F0;
+      constexpr std::uint64_t zeros = 0x3030303030303030;
+      constexpr std::uint64_t sixes = 0x0606060606060606;
+      return (chunk & high) == zeros && ((chunk + sixes) & high) == zeros;
+    }
+
+    inline std::uint64_t parseEightDigits(std::uint64_t chunk) noexcept
+    {
+      constexpr std::uint64_t mask = 0x000000FF000000FF;
+      constexpr std::uint64_t mul1 = 100 + (1000000ULL << 32);
+      constexpr std::uint64_t mul2 = 1 + (10000ULL << 32);
+      chunk -= 0x3030303030303030;
+      chunk = (chunk * 10) + (chunk >> 8);
+      return (((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32;
+    }
+  }
+
+  inline FastReader::FastReader(std::istream& in, size_type bufferSize):
+    in_(std::addressof(in)),
+    fd_(-1),
+    buffer_(new char[bufferSize]),
+    capacity_(bufferSize),
+    pos_(buffer_.get()),
+    end_(buffer_.get()),
+    failed_(false),
+    exhausted_(false)
+  {
+    assert(bufferSize > 0 && "FastReader: empty buffer");
+  }
+
+  inline FastReader::FastReader(int fd, size_type bufferSize):
+    in_(nullptr),
+    fd_(fd),
+    buffer_(new char[bufferSize]),
+    capacity_(bufferSize),
+    pos_(buffer_.get()),
+    end_(buffer_.get()),
+    failed_(false),
+    exhausted_(false)
+  {
+    assert(bufferSize > 0 && "FastReader: empty buffer");
+  }
+
+  inline bool FastReader::readUint64(std::uint64_t& value)
+  {
+    return readInteger(value);
+  }
+
+  inline bool FastReader::readInt64(std::int64_t& value)
+  {
+    return readInteger(value);
+  }
+
+  template < typename Integer >
+  bool FastReader::readInteger(Integer& value)
+  {
+    static_assert(std::is_integral< Integer >::value, "FastReader: integer expected");
+    using Limits = std::numeric_limits< Integer >;
+    if (failed_ || !skipSpaces()) {
+      failed_ = true;
+      return false;
+    }
+    const bool isNegative = *pos_ == '-';
+    if (isNegative || *pos_ == '+') {
+      ++pos_;
+    }
+    const std::uint64_t max = static_cast< std::uint64_t >(Limits::max());
+    const std::uint64_t limit = isNegative && Limits::is_signed ? max + 1 : max;
+    std::uint64_t magnitude = 0;
+    if (!readMagnitude(magnitude, limit)) {
+      failed_ = true;
+      if (magnitude == 0) {
+        value = 0;
+      } else {
+        value = Limits::is_signed && isNegative ? Limits::min() : Limits::max();
+      }
+      return false;
+    }
+    if (!isNegative) {
+      value = static_cast< Integer >(magnitude);
+    } else if (Limits::is_signed) {
+      value = magnitude == limit ? Limits::min() : -static_cast< Integer >(magnitude);
+    } else {
+      value = static_cast< Integer >(0 - magnitude);
+    }
+    return true;
+  }
+
+  inline bool FastReader::readToken(std::string& token)
+  {
+    if (failed_ || !skipSpaces()) {
+      failed_ = true;
+      return false;
+    }
+    token.clear();
+    do {
+      const char* first = pos_;
+      while (pos_ != end_ && !detail::isSpace(*pos_)) {
+        ++pos_;
+      }
+      token.append(first, pos_);
+    } while (pos_ == end_ && fill());
+    return true;
+  }
+
+  inline FastReader::operator bool() const noexcept
+  {
+    return !failed_;
+  }
+
+  inline bool FastReader::eof() const noexcept
+  {
+    return exhausted_ && pos_ == end_;
+  }
+
+  inline void FastReader::clear() noexcept
+  {
+    failed_ = false;
+  }
+
+  inline bool FastReader::fill()
+  {
+    if (exhausted_) {
+      return false;
+    }
+    assert(pos_ == end_ && "FastReader: refilling non-empty buffer");
+    char* data = buffer_.get();
+    size_type got = 0;
+    if (in_ != nullptr) {
+      in_->read(data, capacity_);
+      got = static_cast< size_type >(in_->gcount());
+    } else {
+      ssize_t result = 0;
+      do {
+        result = ::read(fd_, data, capacity_);
+      } while (result < 0 && errno == EINTR);
+      if (result < 0) {
+        throw std::system_error(errno, std::generic_category(), "FastReader: read failed");
+      }
+      got = static_cast< size_type >(result);
+    }
+    pos_ = data;
+    end_ = data + got;
+    exhausted_ = got == 0;
+    return got != 0;
+  }
+
+  inline bool FastReader::skipSpaces()
+  {
+    do {
+      while (pos_ != end_ && detail::isSpace(*pos_)) {
+        ++pos_;
+      }
+      if (pos_ != end_) {
+        return true;
+      }
+    } while (fill());
+    return false;
+  }
+
+  /*
+   * Consumes the digits at the current position, eight at a time while the
+   * value cannot overflow. Fails when there are no digits (magnitude is zero
+   * then) or when the value exceeds limit (magnitude is limit then).
+   */
+  inline bool FastReader::readMagnitude(std::uint64_t& magnitude, std::uint64_t limit)
+  {
+    constexpr std::uint64_t swarSafe = 100000000000ULL;
+    bool hasDigits = false;
+    bool isOverflow = false;
+    magnitude = 0;
+    do {
+      while (!isOverflow && magnitude < swarSafe && end_ - pos_ >= 8) {
+        const std::uint64_t chunk = detail::loadEightBytes(pos_);
+        if (!detail::isEightDigits(chunk)) {
+          break;
+        }
+        magnitude = magnitude * 100000000 + detail::parseEightDigits(chunk);
+        isOverflow = magnitude > limit;
+        hasDigits = true;
+        pos_ += 8;
+      }
+      while (pos_ != end_ && detail::isDigit(*pos_)) {
+        const std::uint64_t digit = *pos_ - '0';
+        if (!isOverflow && magnitude > (limit - digit) / 10) {
+          isOverflow = true;
+        }
+        if (!isOverflow) {
+          magnitude = magnitude * 10 + digit;
+        }
+        hasDigits = true;
+        ++pos_;
+      }
+    } while (pos_ == end_ && fill());
+    if (!hasDigits) {
+      magnitude = 0;
+      return false;
+    }
+    if (isOverflow) {
+      magnitude = limit;
+      return false;
+    }
+    return true;
+  }
+}
+
+#endif
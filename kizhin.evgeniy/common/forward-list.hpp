@@ -11,7 +11,7 @@
 #include "type-utils.hpp"
 
 namespace kizhin {
-  template < typename T >
+  template < typename T, typename Allocator >
   class ForwardList final
   {
   public:
@@ -19,22 +19,28 @@ namespace kizhin {
     using reference = value_type&;
     using const_reference = const value_type&;
     using size_type = std::size_t;
+    using allocator_type = Allocator;
     using iterator = detail::ForwardListIterator< value_type, false >;
     using const_iterator = detail::ForwardListIterator< value_type, true >;
 
     ForwardList();
+    explicit ForwardList(const allocator_type&);
     ForwardList(const ForwardList&);
     ForwardList(ForwardList&&) noexcept;
-    explicit ForwardList(size_type, const_reference = value_type());
+    explicit ForwardList(size_type, const_reference = value_type(),
+        const allocator_type& = allocator_type());
     template < typename InputIt, enable_if_input_iterator< InputIt > = 0 >
-    ForwardList(InputIt, InputIt);
-    ForwardList(std::initializer_list< value_type >);
+    ForwardList(InputIt, InputIt, const allocator_type& = allocator_type());
+    ForwardList(std::initializer_list< value_type >,
+        const allocator_type& = allocator_type());
     ~ForwardList();
 
     ForwardList& operator=(const ForwardList&);
     ForwardList& operator=(ForwardList&&) noexcept;
     ForwardList& operator=(std::initializer_list< value_type >);
 
+    allocator_type getAllocator() const;
+
     iterator begin() noexcept;
     iterator end() noexcept;
     iterator beforeBegin() noexcept;
@@ -102,205 +108,231 @@ namespace kizhin {
 
   private:
     using Node = detail::Node< value_type >;
+    using NodeAllocator =
+        typename std::allocator_traits< Allocator >::template rebind_alloc< Node >;
+    using NodeTraits = std::allocator_traits< NodeAllocator >;
 
+    NodeAllocator alloc_;
     Node* beforeBegin_;
     Node* end_;
     size_type size_;
+
+    template < typename... Args >
+    Node* createNode(Node*, Args&&...);
+    void destroyNode(Node*) noexcept;
+    void releaseBeforeBegin() noexcept;
   };
 
-  template < typename T >
-  ForwardList< T >::ForwardList():
-    beforeBegin_(static_cast< Node* >(operator new(sizeof(Node)))),
+  template < typename T, typename Allocator >
+  ForwardList< T, Allocator >::ForwardList():
+    ForwardList(allocator_type())
+  {}
+
+  template < typename T, typename Allocator >
+  ForwardList< T, Allocator >::ForwardList(const allocator_type& alloc):
+    alloc_(alloc),
+    beforeBegin_(NodeTraits::allocate(alloc_, 1)),
     end_(beforeBegin_),
     size_(0)
   {
     beforeBegin_->next = nullptr;
   }
 
-  template < typename T >
-  ForwardList< T >::ForwardList(const ForwardList& rhs):
-    ForwardList()
+  template < typename T, typename Allocator >
+  ForwardList< T, Allocator >::ForwardList(const ForwardList& rhs):
+    ForwardList(NodeTraits::select_on_container_copy_construction(rhs.alloc_))
   {
     insertAfter(beforeBegin(), rhs.begin(), rhs.end());
   }
 
-  template < typename T >
-  ForwardList< T >::ForwardList(ForwardList&& rhs) noexcept:
+  template < typename T, typename Allocator >
+  ForwardList< T, Allocator >::ForwardList(ForwardList&& rhs) noexcept:
+    alloc_(std::move(rhs.alloc_)),
     beforeBegin_(std::exchange(rhs.beforeBegin_, nullptr)),
     end_(std::exchange(rhs.end_, nullptr)),
     size_(std::exchange(rhs.size_, 0))
   {}
 
-  template < typename T >
-  ForwardList< T >::ForwardList(size_type size, const_reference value):
-    ForwardList()
+  template < typename T, typename Allocator >
+  ForwardList< T, Allocator >::ForwardList(size_type size, const_reference value,
+      const allocator_type& alloc):
+    ForwardList(alloc)
   {
     insertAfter(beforeBegin(), size, value);
   }
 
-  template < typename T >
+  template < typename T, typename Allocator >
   template < typename InputIt, enable_if_input_iterator< InputIt > >
-  ForwardList< T >::ForwardList(InputIt first, InputIt last):
-    ForwardList()
+  ForwardList< T, Allocator >::ForwardList(InputIt first, InputIt last,
+      const allocator_type& alloc):
+    ForwardList(alloc)
   {
     insertAfter(beforeBegin(), first, last);
   }
 
-  template < typename T >
-  ForwardList< T >::ForwardList(std::initializer_list< value_type > init):
-    ForwardList(init.begin(), init.end())
+  template < typename T, typename Allocator >
+  ForwardList< T, Allocator >::ForwardList(std::initializer_list< value_type > init,
+      const allocator_type& alloc):
+    ForwardList(init.begin(), init.end(), alloc)
   {}
 
-  template < typename T >
-  ForwardList< T >::~ForwardList()
+  template < typename T, typename Allocator >
+  ForwardList< T, Allocator >::~ForwardList()
   {
     clear();
-    operator delete(beforeBegin_);
+    releaseBeforeBegin();
   }
 
-  template < typename T >
-  ForwardList< T >& ForwardList< T >::operator=(const ForwardList& rhs)
+  template < typename T, typename Allocator >
+  ForwardList< T, Allocator >& ForwardList< T, Allocator >::operator=(const ForwardList& rhs)
   {
     ForwardList tmp(rhs);
     swap(tmp);
     return *this;
   }
 
-  template < typename T >
-  ForwardList< T >& ForwardList< T >::operator=(ForwardList&& rhs) noexcept
+  template < typename T, typename Allocator >
+  ForwardList< T, Allocator >& ForwardList< T, Allocator >::operator=(ForwardList&& rhs) noexcept
   {
     clear();
-    operator delete(beforeBegin_);
+    releaseBeforeBegin();
+    alloc_ = std::move(rhs.alloc_);
     beforeBegin_ = std::exchange(rhs.beforeBegin_, nullptr);
     end_ = std::exchange(rhs.end_, nullptr);
     size_ = std::exchange(rhs.size_, 0);
     return *this;
   }
 
-  template < typename T >
-  ForwardList< T >& ForwardList< T >::operator=(std::initializer_list< value_type > init)
+  template < typename T, typename Allocator >
+  ForwardList< T, Allocator >& ForwardList< T, Allocator >::operator=(std::initializer_list< value_type > init)
   {
-    ForwardList tmp(init);
+    ForwardList tmp(init, getAllocator());
     swap(tmp);
     return *this;
   }
 
-  template < typename T >
-  typename ForwardList< T >::iterator ForwardList< T >::begin() noexcept
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::allocator_type ForwardList< T,
+      Allocator >::getAllocator() const
+  {
+    return allocator_type(alloc_);
+  }
+
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::iterator ForwardList< T, Allocator >::begin() noexcept
   {
     return iterator(beforeBegin_->next);
   }
 
-  template < typename T >
-  typename ForwardList< T >::iterator ForwardList< T >::end() noexcept
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::iterator ForwardList< T, Allocator >::end() noexcept
   {
     return iterator(nullptr);
   }
 
-  template < typename T >
-  typename ForwardList< T >::iterator ForwardList< T >::beforeBegin() noexcept
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::iterator ForwardList< T, Allocator >::beforeBegin() noexcept
   {
     return iterator(beforeBegin_);
   }
 
-  template < typename T >
-  typename ForwardList< T >::const_iterator ForwardList< T >::begin() const noexcept
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::const_iterator ForwardList< T, Allocator >::begin() const noexcept
   {
     return const_iterator(beforeBegin_->next);
   }
 
-  template < typename T >
-  typename ForwardList< T >::const_iterator ForwardList< T >::end() const noexcept
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::const_iterator ForwardList< T, Allocator >::end() const noexcept
   {
     return const_iterator(nullptr);
   }
 
-  template < typename T >
-  typename ForwardList< T >::const_iterator ForwardList< T >::beforeBegin() const noexcept
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::const_iterator ForwardList< T, Allocator >::beforeBegin() const noexcept
   {
     return const_iterator(beforeBegin_);
   }
 
-  template < typename T >
-  typename ForwardList< T >::reference ForwardList< T >::front() noexcept
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::reference ForwardList< T, Allocator >::front() noexcept
   {
     assert(!empty() && "ForwardList: front() called on empty list");
     return beforeBegin_->next->data;
   }
 
-  template < typename T >
-  typename ForwardList< T >::reference ForwardList< T >::back() noexcept
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::reference ForwardList< T, Allocator >::back() noexcept
   {
     assert(!empty() && "ForwardList: back() called on empty list");
     return end_->data;
   }
 
-  template < typename T >
-  typename ForwardList< T >::const_reference ForwardList< T >::front() const noexcept
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::const_reference ForwardList< T, Allocator >::front() const noexcept
   {
     assert(!empty() && "ForwardList: front() called on empty list");
     return beforeBegin_->next->data;
   }
 
-  template < typename T >
-  typename ForwardList< T >::const_reference ForwardList< T >::back() const noexcept
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::const_reference ForwardList< T, Allocator >::back() const noexcept
   {
     assert(!empty() && "ForwardList: back() called on empty list");
     return end_->data;
   }
 
-  template < typename T >
-  bool ForwardList< T >::empty() const noexcept
+  template < typename T, typename Allocator >
+  bool ForwardList< T, Allocator >::empty() const noexcept
   {
     return size_ == 0;
   }
 
-  template < typename T >
-  typename ForwardList< T >::size_type ForwardList< T >::size() const noexcept
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::size_type ForwardList< T, Allocator >::size() const noexcept
   {
     return size_;
   }
 
-  template < typename T >
-  void ForwardList< T >::pushBack(const_reference value)
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::pushBack(const_reference value)
   {
     emplaceBack(value);
   }
 
-  template < typename T >
-  void ForwardList< T >::pushBack(value_type&& value)
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::pushBack(value_type&& value)
   {
     emplaceBack(std::move(value));
   }
 
-  template < typename T >
-  void ForwardList< T >::pushFront(const_reference value)
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::pushFront(const_reference value)
   {
     emplaceFront(value);
   }
 
-  template < typename T >
-  void ForwardList< T >::pushFront(value_type&& value)
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::pushFront(value_type&& value)
   {
     emplaceFront(std::move(value));
   }
 
-  template < typename T >
+  template < typename T, typename Allocator >
   template < typename... Args >
-  void ForwardList< T >::emplaceBack(Args&&... args)
+  void ForwardList< T, Allocator >::emplaceBack(Args&&... args)
   {
-    Node* newNode = new Node{ value_type(std::forward< Args >(args)...), nullptr };
+    Node* newNode = createNode(nullptr, std::forward< Args >(args)...);
     end_->next = newNode;
     end_ = end_->next;
     ++size_;
   }
 
-  template < typename T >
+  template < typename T, typename Allocator >
   template < typename... Args >
-  void ForwardList< T >::emplaceFront(Args&&... args)
+  void ForwardList< T, Allocator >::emplaceFront(Args&&... args)
   {
-    Node* newNode = new Node{ value_type(std::forward< Args >(args)...), nullptr };
-    newNode->next = beforeBegin_->next;
+    Node* newNode = createNode(beforeBegin_->next, std::forward< Args >(args)...);
     beforeBegin_->next = newNode;
     if (newNode->next == nullptr) {
       end_ = newNode;
@@ -308,9 +340,9 @@ namespace kizhin {
     ++size_;
   }
 
-  template < typename T >
+  template < typename T, typename Allocator >
   template < typename... Args >
-  typename ForwardList< T >::iterator ForwardList< T >::emplaceAfter(
+  typename ForwardList< T, Allocator >::iterator ForwardList< T, Allocator >::emplaceAfter(
       const_iterator position, Args&&... args)
   {
     assert(position != end() && "ForwardList: emplaceAfter called with end iterator");
@@ -323,31 +355,31 @@ namespace kizhin {
       return iterator(end_);
     }
     Node* prev = position.node_;
-    prev->next = new Node{ value_type(std::forward< Args >(args)...), prev->next };
+    prev->next = createNode(prev->next, std::forward< Args >(args)...);
     ++size_;
     return iterator(prev->next);
   }
 
-  template < typename T >
-  void ForwardList< T >::popBack() noexcept
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::popBack() noexcept
   {
     assert(!empty() && "ForwardList: popBack() called on empty list");
     Node* current = beforeBegin_;
     while (current->next != end_) {
       current = current->next;
     }
-    delete current->next;
+    destroyNode(current->next);
     current->next = nullptr;
     end_ = current;
     --size_;
   }
 
-  template < typename T >
-  void ForwardList< T >::popFront() noexcept
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::popFront() noexcept
   {
     assert(!empty() && "ForwardList: popFront() called on empty list");
     Node* tmp = beforeBegin_->next->next;
-    delete beforeBegin_->next;
+    destroyNode(beforeBegin_->next);
     beforeBegin_->next = tmp;
     if (tmp == nullptr) {
       end_ = beforeBegin_;
@@ -355,8 +387,8 @@ namespace kizhin {
     --size_;
   }
 
-  template < typename T >
-  typename ForwardList< T >::iterator ForwardList< T >::eraseAfter(
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::iterator ForwardList< T, Allocator >::eraseAfter(
       const_iterator position)
   {
     assert(!empty() && "ForwardList: cannot erase from empty list");
@@ -365,8 +397,8 @@ namespace kizhin {
     return eraseAfter(position, std::next(position, 2));
   }
 
-  template < typename T >
-  typename ForwardList< T >::iterator ForwardList< T >::eraseAfter(const_iterator first,
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::iterator ForwardList< T, Allocator >::eraseAfter(const_iterator first,
       const_iterator last)
   {
     assert(!empty() && "ForwardList: cannot erase from empty list");
@@ -375,7 +407,7 @@ namespace kizhin {
     Node* lastPtr = last.node_;
     while (firstPtr != lastPtr) {
       Node* tmp = firstPtr->next;
-      delete firstPtr;
+      destroyNode(firstPtr);
       firstPtr = tmp;
       --size_;
     }
@@ -386,38 +418,38 @@ namespace kizhin {
     return iterator(first.node_);
   }
 
-  template < typename T >
-  void ForwardList< T >::assign(size_type size, const_reference value)
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::assign(size_type size, const_reference value)
   {
-    ForwardList tmp(size, value);
+    ForwardList tmp(size, value, getAllocator());
     swap(tmp);
   }
 
-  template < typename T >
+  template < typename T, typename Allocator >
   template < typename InputIt, enable_if_input_iterator< InputIt > >
-  void ForwardList< T >::assign(InputIt first, InputIt last)
+  void ForwardList< T, Allocator >::assign(InputIt first, InputIt last)
   {
-    ForwardList tmp(first, last);
+    ForwardList tmp(first, last, getAllocator());
     swap(tmp);
   }
 
-  template < typename T >
-  void ForwardList< T >::assign(std::initializer_list< value_type > init)
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::assign(std::initializer_list< value_type > init)
   {
-    ForwardList tmp(init);
+    ForwardList tmp(init, getAllocator());
     swap(tmp);
   }
 
-  template < typename T >
-  typename ForwardList< T >::iterator ForwardList< T >::insertAfter(
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::iterator ForwardList< T, Allocator >::insertAfter(
       const_iterator position, value_type value)
   {
     assert(position != end() && "ForwardList: insertAfter called with end iterator");
     return emplaceAfter(position, std::move(value));
   }
 
-  template < typename T >
-  typename ForwardList< T >::iterator ForwardList< T >::insertAfter(
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::iterator ForwardList< T, Allocator >::insertAfter(
       const_iterator position, size_type size, const_reference value)
   {
     assert(position != end() && "ForwardList: insertAfter called with end iterator");
@@ -432,9 +464,9 @@ namespace kizhin {
     return result;
   }
 
-  template < typename T >
+  template < typename T, typename Allocator >
   template < typename InputIt, enable_if_input_iterator< InputIt > >
-  typename ForwardList< T >::iterator ForwardList< T >::insertAfter(
+  typename ForwardList< T, Allocator >::iterator ForwardList< T, Allocator >::insertAfter(
       const_iterator position, InputIt first, InputIt last)
   {
     assert(position != end() && "ForwardList: insertAfter called with end iterator");
@@ -450,33 +482,34 @@ namespace kizhin {
     return result;
   }
 
-  template < typename T >
-  typename ForwardList< T >::iterator ForwardList< T >::insertAfter(
+  template < typename T, typename Allocator >
+  typename ForwardList< T, Allocator >::iterator ForwardList< T, Allocator >::insertAfter(
       const_iterator position, std::initializer_list< value_type > init)
   {
     assert(position != end() && "ForwardList: insertAfter called with end iterator");
     return insertAfter(position, init.begin(), init.end());
   }
 
-  template < typename T >
-  void ForwardList< T >::clear() noexcept
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::clear() noexcept
   {
     while (!empty()) {
       popFront();
     }
   }
 
-  template < typename T >
-  void ForwardList< T >::swap(ForwardList& rhs) noexcept
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::swap(ForwardList& rhs) noexcept
   {
     using std::swap;
+    swap(alloc_, rhs.alloc_);
     swap(beforeBegin_, rhs.beforeBegin_);
     swap(end_, rhs.end_);
     swap(size_, rhs.size_);
   }
 
-  template < typename T >
-  void ForwardList< T >::reverse() noexcept
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::reverse() noexcept
   {
     Node* prev = nullptr;
     Node* curr = beforeBegin_->next;
@@ -490,28 +523,29 @@ namespace kizhin {
     beforeBegin_->next = prev;
   }
 
-  template < typename T >
-  void ForwardList< T >::spliceAfter(const_iterator position, ForwardList& source)
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::spliceAfter(const_iterator position, ForwardList& source)
   {
     if (!source.empty()) {
       spliceAfter(position, source, source.beforeBegin(), source.end());
     }
   }
 
-  template < typename T >
-  void ForwardList< T >::spliceAfter(const_iterator position, ForwardList& source,
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::spliceAfter(const_iterator position, ForwardList& source,
       const_iterator sourcePosition)
   {
     spliceAfter(position, source, sourcePosition, std::next(sourcePosition, 2));
   }
 
-  template < typename T >
-  void ForwardList< T >::spliceAfter(const_iterator position, ForwardList& source,
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::spliceAfter(const_iterator position, ForwardList& source,
       const_iterator first, const_iterator last)
   {
     if (first == last || std::addressof(source) == this) {
       return;
     }
+    assert(alloc_ == source.alloc_ && "ForwardList: splice between unequal allocators");
     Node* next = position.node_->next;
     position.node_->next = first.node_->next;
     size_type distance = std::distance(first, last) - 1;
@@ -528,8 +562,8 @@ namespace kizhin {
     source.size_ -= distance;
   }
 
-  template < typename T >
-  void ForwardList< T >::remove(const_reference value)
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::remove(const_reference value)
   {
     const auto pred = [&value](const_reference rhs) -> bool
     {
@@ -538,9 +572,9 @@ namespace kizhin {
     removeIf(pred);
   }
 
-  template < typename T >
+  template < typename T, typename Allocator >
   template < typename UnaryPredicate >
-  void ForwardList< T >::removeIf(UnaryPredicate p)
+  void ForwardList< T, Allocator >::removeIf(UnaryPredicate p)
   {
     const_iterator curr = begin();
     const_iterator prev = beforeBegin();
@@ -554,15 +588,15 @@ namespace kizhin {
     }
   }
 
-  template < typename T >
-  void ForwardList< T >::unique()
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::unique()
   {
     return unique(std::equal_to< value_type >{});
   }
 
-  template < typename T >
+  template < typename T, typename Allocator >
   template < typename BinaryPredicate >
-  void ForwardList< T >::unique(BinaryPredicate p)
+  void ForwardList< T, Allocator >::unique(BinaryPredicate p)
   {
     if (empty()) {
       return;
@@ -572,7 +606,7 @@ namespace kizhin {
       if (p(curr->data, curr->next->data)) {
         Node* tmp = curr->next;
         curr->next = tmp->next;
-        delete tmp;
+        destroyNode(tmp);
         --size_;
       } else {
         curr = curr->next;
@@ -581,15 +615,15 @@ namespace kizhin {
     end_ = curr;
   }
 
-  template < typename T >
-  void ForwardList< T >::merge(ForwardList& source)
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::merge(ForwardList& source)
   {
     merge(source, std::less< value_type >{});
   }
 
-  template < typename T >
+  template < typename T, typename Allocator >
   template < typename Comparator >
-  void ForwardList< T >::merge(ForwardList& source, Comparator comp)
+  void ForwardList< T, Allocator >::merge(ForwardList& source, Comparator comp)
   {
     if (this == std::addressof(source) || source.empty()) {
       return;
@@ -600,7 +634,7 @@ namespace kizhin {
     }
     iterator thisCurr = begin();
     iterator sourceCurr = source.begin();
-    ForwardList result;
+    ForwardList result(getAllocator());
     while (thisCurr != end() && sourceCurr != source.end()) {
       if (comp(*thisCurr, *sourceCurr)) {
         result.emplaceBack(*thisCurr);
@@ -616,22 +650,22 @@ namespace kizhin {
     swap(result);
   }
 
-  template < typename T >
-  void ForwardList< T >::sort()
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::sort()
   {
     return sort(std::less< value_type >{});
   }
 
-  template < typename T >
+  template < typename T, typename Allocator >
   template < typename Comparator >
-  void ForwardList< T >::sort(Comparator comp)
+  void ForwardList< T, Allocator >::sort(Comparator comp)
   {
     if (size_ <= 1) {
       return;
     }
     const iterator mid = std::next(begin(), size_ / 2);
-    ForwardList< T > left;
-    ForwardList< T > right;
+    ForwardList left(getAllocator());
+    ForwardList right(getAllocator());
     left.spliceAfter(left.beforeBegin(), *this, beforeBegin(), mid);
     right.spliceAfter(right.beforeBegin(), *this, beforeBegin(), end());
 
@@ -640,6 +674,37 @@ namespace kizhin {
     merge(left, comp);
     merge(right, comp);
   }
+
+  template < typename T, typename Allocator >
+  template < typename... Args >
+  typename ForwardList< T, Allocator >::Node* ForwardList< T, Allocator >::createNode(
+      Node* next, Args&&... args)
+  {
+    Node* node = NodeTraits::allocate(alloc_, 1);
+    try {
+      NodeTraits::construct(alloc_, std::addressof(node->data), std::forward< Args >(args)...);
+    } catch (...) {
+      NodeTraits::deallocate(alloc_, node, 1);
+      throw;
+    }
+    node->next = next;
+    return node;
+  }
+
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::destroyNode(Node* node) noexcept
+  {
+    NodeTraits::destroy(alloc_, std::addressof(node->data));
+    NodeTraits::deallocate(alloc_, node, 1);
+  }
+
+  template < typename T, typename Allocator >
+  void ForwardList< T, Allocator >::releaseBeforeBegin() noexcept
+  {
+    if (beforeBegin_ != nullptr) {
+      NodeTraits::deallocate(alloc_, beforeBegin_, 1);
+    }
+  }
 }
 
 #endif
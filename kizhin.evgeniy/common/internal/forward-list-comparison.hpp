@@ -5,38 +5,38 @@
 #include "forward-list-fwd.hpp"
 
 namespace kizhin {
-  template < typename T >
-  bool operator==(const ForwardList< T >& lhs, const ForwardList< T >& rhs)
+  template < typename T, typename Allocator >
+  bool operator==(const ForwardList< T, Allocator >& lhs, const ForwardList< T, Allocator >& rhs)
   {
     return lhs.size() == rhs.size() && compare(lhs.begin(), lhs.end(), rhs.begin());
   }
 
-  template < typename T >
-  bool operator!=(const ForwardList< T >& lhs, const ForwardList< T >& rhs)
+  template < typename T, typename Allocator >
+  bool operator!=(const ForwardList< T, Allocator >& lhs, const ForwardList< T, Allocator >& rhs)
   {
     return !(lhs == rhs);
   }
 
-  template < typename T >
-  bool operator<(const ForwardList< T >& lhs, const ForwardList< T >& rhs)
+  template < typename T, typename Allocator >
+  bool operator<(const ForwardList< T, Allocator >& lhs, const ForwardList< T, Allocator >& rhs)
   {
     return lexicographicalCompare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
   }
 
-  template < typename T >
-  bool operator>(const ForwardList< T >& lhs, const ForwardList< T >& rhs)
+  template < typename T, typename Allocator >
+  bool operator>(const ForwardList< T, Allocator >& lhs, const ForwardList< T, Allocator >& rhs)
   {
     return rhs < lhs;
   }
 
-  template < typename T >
-  bool operator<=(const ForwardList< T >& lhs, const ForwardList< T >& rhs)
+  template < typename T, typename Allocator >
+  bool operator<=(const ForwardList< T, Allocator >& lhs, const ForwardList< T, Allocator >& rhs)
   {
     return !(lhs > rhs);
   }
 
-  template < typename T >
-  bool operator>=(const ForwardList< T >& lhs, const ForwardList< T >& rhs)
+  template < typename T, typename Allocator >
+  bool operator>=(const ForwardList< T, Allocator >& lhs, const ForwardList< T, Allocator >& rhs)
   {
     return !(lhs < rhs);
   }
@@ -1,8 +1,10 @@
 #ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_INTERNAL_FORWARD_LIST_FWD_HPP
 #define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_INTERNAL_FORWARD_LIST_FWD_HPP
 
+#include <memory>
+
 namespace kizhin {
-  template < typename T >
+  template < typename T, typename Allocator = std::allocator< T > >
   class ForwardList;
 }
 
@@ -39,7 +39,8 @@ namespace kizhin {
       {}
 
       friend class ForwardListIterator< T, !IsConst >;
-      friend class ::kizhin::ForwardList< value_type >;
+      template < typename, typename >
+      friend class ::kizhin::ForwardList;
       template < typename U, bool IsLhsConst, bool IsRhsConst >
       friend bool operator==(const ForwardListIterator< U, IsLhsConst >&,
           const ForwardListIterator< U, IsRhsConst >&) noexcept;
@@ -4,8 +4,8 @@
 #include "forward-list-fwd.hpp"
 
 namespace kizhin {
-  template < typename T >
-  void swap(ForwardList< T >& lhs, ForwardList< T >& rhs) noexcept
+  template < typename T, typename Allocator >
+  void swap(ForwardList< T, Allocator >& lhs, ForwardList< T, Allocator >& rhs) noexcept
   {
     lhs.swap(rhs);
   }
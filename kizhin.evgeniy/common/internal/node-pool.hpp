@@ -0,0 +1,156 @@
+#ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_INTERNAL_NODE_POOL_HPP
+#define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_INTERNAL_NODE_POOL_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace kizhin {
+  namespace detail {
+    /*
+     * Hands out uninitialized storage for single nodes. Storage is taken from the
+     * allocator in chunks that double in size up to MaxChunkSize nodes, and
+     * released nodes are kept on a free list for reuse. The first slot of every
+     * chunk records the chunk itself, so the memory goes back to the allocator
+     * only when the pool is destroyed.
+     */
+    template < typename Node, typename Allocator, std::size_t MaxChunkSize = 64 >
+    class NodePool final
+    {
+    public:
+      using allocator_type =
+          typename std::allocator_traits< Allocator >::template rebind_alloc< Node >;
+      using size_type = std::size_t;
+
+      explicit NodePool(const allocator_type& = allocator_type());
+      NodePool(const NodePool&) = delete;
+      NodePool(NodePool&&) noexcept;
+      ~NodePool();
+
+      NodePool& operator=(const NodePool&) = delete;
+      NodePool& operator=(NodePool&&) = delete;
+
+      Node* allocate();
+      void deallocate(Node*) noexcept;
+
+      const allocator_type& getAllocator() const noexcept;
+      void swap(NodePool&) noexcept;
+
+    private:
+      using Traits = std::allocator_traits< allocator_type >;
+
+      struct FreeSlot
+      {
+        FreeSlot* next;
+      };
+
+      struct Chunk
+      {
+        Chunk* next;
+        size_type size;
+      };
+
+      static_assert(sizeof(Node) >= sizeof(Chunk), "NodePool: node too small");
+      static_assert(MaxChunkSize >= 2, "NodePool: chunk has no room for nodes");
+
+      allocator_type alloc_;
+      Chunk* chunks_;
+      FreeSlot* free_;
+      Node* fresh_;
+      size_type freshCount_;
+      size_type nextChunkSize_;
+
+      void grow();
+    };
+
+    template < typename Node, typename Allocator, std::size_t MaxChunkSize >
+    NodePool< Node, Allocator, MaxChunkSize >::NodePool(const allocator_type& alloc):
+      alloc_(alloc),
+      chunks_(nullptr),
+      free_(nullptr),
+      fresh_(nullptr),
+      freshCount_(0),
+      nextChunkSize_(2)
+    {}
+
+    template < typename Node, typename Allocator, std::size_t MaxChunkSize >
+    NodePool< Node, Allocator, MaxChunkSize >::NodePool(NodePool&& rhs) noexcept:
+      alloc_(std::move(rhs.alloc_)),
+      chunks_(std::exchange(rhs.chunks_, nullptr)),
+      free_(std::exchange(rhs.free_, nullptr)),
+      fresh_(std::exchange(rhs.fresh_, nullptr)),
+      freshCount_(std::exchange(rhs.freshCount_, 0)),
+      nextChunkSize_(std::exchange(rhs.nextChunkSize_, 2))
+    {}
+
+    template < typename Node, typename Allocator, std::size_t MaxChunkSize >
+    NodePool< Node, Allocator, MaxChunkSize >::~NodePool()
+    {
+      while (chunks_ != nullptr) {
+        Chunk* next = chunks_->next;
+        const size_type size = chunks_->size;
+        Node* storage = reinterpret_cast< Node* >(chunks_);
+        chunks_->~Chunk();
+        Traits::deallocate(alloc_, storage, size);
+        chunks_ = next;
+      }
+    }
+
+    template < typename Node, typename Allocator, std::size_t MaxChunkSize >
+    Node* NodePool< Node, Allocator, MaxChunkSize >::allocate()
+    {
+      if (free_ != nullptr) {
+        FreeSlot* slot = free_;
+        free_ = slot->next;
+        slot->~FreeSlot();
+        return reinterpret_cast< Node* >(slot);
+      }
+      if (freshCount_ == 0) {
+        grow();
+      }
+      --freshCount_;
+      return fresh_++;
+    }
+
+    template < typename Node, typename Allocator, std::size_t MaxChunkSize >
+    void NodePool< Node, Allocator, MaxChunkSize >::deallocate(Node* node) noexcept
+    {
+      assert(node && "NodePool: deallocating null node");
+      free_ = ::new (static_cast< void* >(node)) FreeSlot{ free_ };
+    }
+
+    template < typename Node, typename Allocator, std::size_t MaxChunkSize >
+    const typename NodePool< Node, Allocator, MaxChunkSize >::allocator_type&
+        NodePool< Node, Allocator, MaxChunkSize >::getAllocator() const noexcept
+    {
+      return alloc_;
+    }
+
+    template < typename Node, typename Allocator, std::size_t MaxChunkSize >
+    void NodePool< Node, Allocator, MaxChunkSize >::swap(NodePool& rhs) noexcept
+    {
+      using std::swap;
+      swap(alloc_, rhs.alloc_);
+      swap(chunks_, rhs.chunks_);
+      swap(free_, rhs.free_);
+      swap(fresh_, rhs.fresh_);
+      swap(freshCount_, rhs.freshCount_);
+      swap(nextChunkSize_, rhs.nextChunkSize_);
+    }
+
+    template < typename Node, typename Allocator, std::size_t MaxChunkSize >
+    void NodePool< Node, Allocator, MaxChunkSize >::grow()
+    {
+      const size_type size = nextChunkSize_;
+      Node* storage = Traits::allocate(alloc_, size);
+      chunks_ = ::new (static_cast< void* >(storage)) Chunk{ chunks_, size };
+      fresh_ = storage + 1;
+      freshCount_ = size - 1;
+      nextChunkSize_ = std::min(nextChunkSize_ * 2, MaxChunkSize);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_INTERNAL_UNROLLED_FORWARD_LIST_BLOCK_HPP
+#define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_INTERNAL_UNROLLED_FORWARD_LIST_BLOCK_HPP
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace kizhin {
+  namespace detail {
+    struct BlockBase
+    {
+      BlockBase* next;
+      std::size_t size;
+    };
+
+    template < typename T, std::size_t BlockSize >
+    struct Block final: BlockBase
+    {
+      std::aligned_storage_t< sizeof(T), alignof(T) > storage[BlockSize];
+
+      T* data(std::size_t index) noexcept
+      {
+        return reinterpret_cast< T* >(std::addressof(storage[index]));
+      }
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_INTERNAL_UNROLLED_FORWARD_LIST_COMPARISON_HPP
+#define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_INTERNAL_UNROLLED_FORWARD_LIST_COMPARISON_HPP
+
+#include "algorithm-utils.hpp"
+#include "unrolled-forward-list-fwd.hpp"
+
+namespace kizhin {
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  bool operator==(const UnrolledForwardList< T, BlockSize, Allocator >& lhs,
+      const UnrolledForwardList< T, BlockSize, Allocator >& rhs)
+  {
+    return lhs.size() == rhs.size() && compare(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  bool operator!=(const UnrolledForwardList< T, BlockSize, Allocator >& lhs,
+      const UnrolledForwardList< T, BlockSize, Allocator >& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  bool operator<(const UnrolledForwardList< T, BlockSize, Allocator >& lhs,
+      const UnrolledForwardList< T, BlockSize, Allocator >& rhs)
+  {
+    return lexicographicalCompare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  bool operator>(const UnrolledForwardList< T, BlockSize, Allocator >& lhs,
+      const UnrolledForwardList< T, BlockSize, Allocator >& rhs)
+  {
+    return rhs < lhs;
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  bool operator<=(const UnrolledForwardList< T, BlockSize, Allocator >& lhs,
+      const UnrolledForwardList< T, BlockSize, Allocator >& rhs)
+  {
+    return !(lhs > rhs);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  bool operator>=(const UnrolledForwardList< T, BlockSize, Allocator >& lhs,
+      const UnrolledForwardList< T, BlockSize, Allocator >& rhs)
+  {
+    return !(lhs < rhs);
+  }
+}
+
+#endif
+
@@ -0,0 +1,13 @@
+#ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_INTERNAL_UNROLLED_FORWARD_LIST_FWD_HPP
+#define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_INTERNAL_UNROLLED_FORWARD_LIST_FWD_HPP
+
+#include <cstddef>
+#include <memory>
+
+namespace kizhin {
+  template < typename T, std::size_t BlockSize = 16,
+      typename Allocator = std::allocator< T > >
+  class UnrolledForwardList;
+}
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_INTERNAL_UNROLLED_FORWARD_LIST_ITERATOR_HPP
+#define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_INTERNAL_UNROLLED_FORWARD_LIST_ITERATOR_HPP
+
+#include <cassert>
+#include <iterator>
+#include <type_traits>
+#include "unrolled-forward-list-block.hpp"
+#include "unrolled-forward-list-fwd.hpp"
+
+namespace kizhin {
+  namespace detail {
+    template < typename T, std::size_t BlockSize, bool IsConst >
+    class UnrolledForwardListIterator final
+    {
+    public:
+      using value_type = T;
+      using difference_type = std::ptrdiff_t;
+      using pointer = std::conditional_t< IsConst, const value_type*, value_type* >;
+      using reference = std::conditional_t< IsConst, const value_type&, value_type& >;
+      using iterator_category = std::forward_iterator_tag;
+
+      UnrolledForwardListIterator() = default;
+      template < bool IsRhsConst, std::enable_if_t< IsConst && !IsRhsConst, int > = 0 >
+      UnrolledForwardListIterator(
+          const UnrolledForwardListIterator< T, BlockSize, IsRhsConst >&) noexcept;
+
+      pointer operator->() const noexcept;
+      reference operator*() const noexcept;
+
+      UnrolledForwardListIterator& operator++() noexcept;
+      UnrolledForwardListIterator operator++(int) noexcept;
+
+    private:
+      using Block = detail::Block< value_type, BlockSize >;
+
+      BlockBase* block_ = nullptr;
+      std::size_t index_ = 0;
+
+      UnrolledForwardListIterator(BlockBase* block, std::size_t index):
+        block_(block),
+        index_(index)
+      {}
+
+      friend class UnrolledForwardListIterator< T, BlockSize, !IsConst >;
+      template < typename, std::size_t, typename >
+      friend class ::kizhin::UnrolledForwardList;
+      template < typename U, std::size_t N, bool IsLhsConst, bool IsRhsConst >
+      friend bool operator==(const UnrolledForwardListIterator< U, N, IsLhsConst >&,
+          const UnrolledForwardListIterator< U, N, IsRhsConst >&) noexcept;
+    };
+
+    template < typename T, std::size_t BlockSize, bool IsConst >
+    template < bool IsRhsConst, std::enable_if_t< IsConst && !IsRhsConst, int > >
+    UnrolledForwardListIterator< T, BlockSize, IsConst >::UnrolledForwardListIterator(
+        const UnrolledForwardListIterator< T, BlockSize, IsRhsConst >& rhs) noexcept:
+      block_(rhs.block_),
+      index_(rhs.index_)
+    {}
+
+    template < typename T, std::size_t BlockSize, bool IsConst >
+    typename UnrolledForwardListIterator< T, BlockSize, IsConst >::pointer
+        UnrolledForwardListIterator< T, BlockSize, IsConst >::operator->() const noexcept
+    {
+      assert(block_ && "UnrolledForwardListIterator: dereferencing empty iterator");
+      return static_cast< Block* >(block_)->data(index_);
+    }
+
+    template < typename T, std::size_t BlockSize, bool IsConst >
+    typename UnrolledForwardListIterator< T, BlockSize, IsConst >::reference
+        UnrolledForwardListIterator< T, BlockSize, IsConst >::operator*() const noexcept
+    {
+      assert(block_ && "UnrolledForwardListIterator: dereferencing empty iterator");
+      return *static_cast< Block* >(block_)->data(index_);
+    }
+
+    template < typename T, std::size_t BlockSize, bool IsConst >
+    UnrolledForwardListIterator< T, BlockSize, IsConst >& UnrolledForwardListIterator< T,
+        BlockSize, IsConst >::operator++() noexcept
+    {
+      assert(block_ && "UnrolledForwardListIterator: incrementing empty iterator");
+      if (++index_ == block_->size) {
+        block_ = block_->next;
+        index_ = 0;
+      }
+      return *this;
+    }
+
+    template < typename T, std::size_t BlockSize, bool IsConst >
+    UnrolledForwardListIterator< T, BlockSize, IsConst > UnrolledForwardListIterator< T,
+        BlockSize, IsConst >::operator++(int) noexcept
+    {
+      UnrolledForwardListIterator tmp(*this);
+      ++(*this);
+      return tmp;
+    }
+
+    template < typename T, std::size_t BlockSize, bool IsLhsConst, bool IsRhsConst >
+    bool operator==(const UnrolledForwardListIterator< T, BlockSize, IsLhsConst >& lhs,
+        const UnrolledForwardListIterator< T, BlockSize, IsRhsConst >& rhs) noexcept
+    {
+      return lhs.block_ == rhs.block_ && lhs.index_ == rhs.index_;
+    }
+
+    template < typename T, std::size_t BlockSize, bool IsLhsConst, bool IsRhsConst >
+    bool operator!=(const UnrolledForwardListIterator< T, BlockSize, IsLhsConst >& lhs,
+        const UnrolledForwardListIterator< T, BlockSize, IsRhsConst >& rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_INTERNAL_UNROLLED_FORWARD_LIST_SWAP_HPP
+#define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_INTERNAL_UNROLLED_FORWARD_LIST_SWAP_HPP
+
+#include "unrolled-forward-list-fwd.hpp"
+
+namespace kizhin {
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void swap(UnrolledForwardList< T, BlockSize, Allocator >& lhs,
+      UnrolledForwardList< T, BlockSize, Allocator >& rhs) noexcept
+  {
+    lhs.swap(rhs);
+  }
+}
+
+#endif
@@ -2,6 +2,7 @@
 #define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_MAP_HPP
 
 #include <algorithm>
+#include <iterator>
 #include <memory>
 #include <tuple>
 #include <utility>
@@ -11,6 +12,10 @@
 #include "type-utils.hpp"
 
 namespace kizhin {
+  struct sorted_unique_t
+  {};
+  constexpr sorted_unique_t sorted_unique{};
+
   template < typename Key, typename T, typename Comparator = std::less< Key > >
   class Map final
   {
@@ -69,6 +74,8 @@ namespace kizhin {
     explicit Map(const key_compare&) noexcept(is_nothrow_copy_constructible);
     template < typename InputIt >
     Map(InputIt, InputIt, const key_compare& = key_compare{});
+    template < typename FwdIt >
+    Map(sorted_unique_t, FwdIt, FwdIt, const key_compare& = key_compare{});
     Map(std::initializer_list< value_type >, const key_compare& = key_compare{});
     ~Map();
 
@@ -160,6 +167,10 @@ namespace kizhin {
     void deallocate() noexcept;
     Node* getEndNode() const noexcept;
 
+    template < typename FwdIt >
+    Node* buildSorted(FwdIt&, size_type count, size_type capacity);
+    static void deallocateSubtree(Node*) noexcept;
+
     template < typename... Args >
     Node* emplaceToNode(Node*, Args&&...);
     template < typename... Args >
@@ -630,7 +641,7 @@ private:
 
 template < typename K, typename T, typename C >
 kizhin::Map< K, T, C >::Map(const Map& rhs):
-  Map(rhs.begin(), rhs.end(), rhs.comparator_)
+  Map(sorted_unique, rhs.begin(), rhs.end(), rhs.comparator_)
 {}
 
 template < typename K, typename T, typename C >
@@ -655,6 +666,28 @@ kizhin::Map< K, T, C >::Map(const InputIt first, const InputIt last,
   insert(first, last);
 }
 
+template < typename K, typename T, typename C >
+template < typename FwdIt >
+kizhin::Map< K, T, C >::Map(sorted_unique_t, FwdIt first, const FwdIt last,
+    const key_compare& comparator):
+  Map(comparator)
+{
+  const size_type count = std::distance(first, last);
+  if (count == 0) {
+    return;
+  }
+  size_type capacity = 2;
+  while (capacity < count) {
+    capacity = capacity * 3 + 2;
+  }
+  std::unique_ptr< Node > endNode = std::make_unique< Node >();
+  root_ = buildSorted(first, count, capacity);
+  size_ = count;
+  Node* max = detail::treeMax(root_);
+  endNode->parent = max;
+  max->children.fill(endNode.release());
+}
+
 template < typename K, typename T, typename C >
 kizhin::Map< K, T, C >::Map(std::initializer_list< value_type > init,
     const key_compare& comparator):
@@ -1044,10 +1077,20 @@ template < typename K, typename T, typename C >
 typename kizhin::Map< K, T, C >::const_iterator kizhin::Map< K, T, C >::lowerBound(
     const key_type& key) const
 {
-  auto res = begin();
-  while (res != end() && keyComp()(res->first, key)) {
-    ++res;
-  };
+  const_iterator res = end();
+  if (empty()) {
+    return res;
+  }
+  for (Node* current = root_; current;) {
+    pointer pos = current->begin;
+    while (pos != current->end && comparator_(pos->first, key)) {
+      ++pos;
+    }
+    if (pos != current->end) {
+      res = const_iterator(current, pos);
+    }
+    current = detail::isLeaf(current) ? nullptr : current->children[pos - current->begin];
+  }
   return res;
 }
 
@@ -1064,10 +1107,20 @@ template < typename K, typename T, typename C >
 typename kizhin::Map< K, T, C >::const_iterator kizhin::Map< K, T, C >::upperBound(
     const key_type& key) const
 {
-  auto res = begin();
-  while (res != end() && !keyComp()(key, res->first)) {
-    ++res;
-  };
+  const_iterator res = end();
+  if (empty()) {
+    return res;
+  }
+  for (Node* current = root_; current;) {
+    pointer pos = current->begin;
+    while (pos != current->end && !comparator_(key, pos->first)) {
+      ++pos;
+    }
+    if (pos != current->end) {
+      res = const_iterator(current, pos);
+    }
+    current = detail::isLeaf(current) ? nullptr : current->children[pos - current->begin];
+  }
   return res;
 }
 
@@ -1172,6 +1225,55 @@ typename kizhin::Map< K, T, C >::Node* kizhin::Map< K, T, C >::getEndNode() cons
   return detail::isEmpty(max) ? max : max->children[0];
 }
 
+template < typename K, typename T, typename C >
+template < typename FwdIt >
+typename kizhin::Map< K, T, C >::Node* kizhin::Map< K, T, C >::buildSorted(FwdIt& first,
+    size_type count, size_type capacity)
+{
+  assert(count > 0 && count <= capacity && "buildSorted: invalid subtree size");
+  std::unique_ptr< Node > node = std::make_unique< Node >();
+  if (capacity == 2) {
+    for (; count != 0; --count, ++first) {
+      detail::emplaceBack(node.get(), *first);
+    }
+    return node.release();
+  }
+  const size_type childCapacity = (capacity - 2) / 3;
+  const size_type childrenCount = count - 1 <= 2 * childCapacity ? 2 : 3;
+  size_type rest = count - (childrenCount - 1);
+  try {
+    for (size_type i = 0; i != childrenCount; ++i) {
+      const size_type childCount = rest / (childrenCount - i);
+      rest -= childCount;
+      node->children[i] = buildSorted(first, childCount, childCapacity);
+      node->children[i]->parent = node.get();
+      if (i + 1 != childrenCount) {
+        detail::emplaceBack(node.get(), *first);
+        ++first;
+      }
+    }
+  } catch (...) {
+    for (Node* child: node->children) {
+      if (child) {
+        deallocateSubtree(child);
+      }
+    }
+    throw;
+  }
+  return node.release();
+}
+
+template < typename K, typename T, typename C >
+void kizhin::Map< K, T, C >::deallocateSubtree(Node* node) noexcept
+{
+  for (Node* child: node->children) {
+    if (child) {
+      deallocateSubtree(child);
+    }
+  }
+  delete node;
+}
+
 template < typename K, typename T, typename C >
 template < typename... Args >
 typename kizhin::Map< K, T, C >::Node* kizhin::Map< K, T, C >::emplaceToNode(Node* node,
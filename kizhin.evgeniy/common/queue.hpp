@@ -34,6 +34,7 @@ namespace kizhin {
     template < typename... Args >
     void emplace(Args&&...);
 
+    void clear() noexcept;
     void swap(Queue&) noexcept(is_nothrow_swappable_v< Container >);
 
   private:
@@ -113,6 +114,12 @@ namespace kizhin {
     container_.emplaceBack(std::forward< Args >(args)...);
   }
 
+  template < typename T, typename C >
+  void Queue< T, C >::clear() noexcept
+  {
+    container_.clear();
+  }
+
   template < typename T, typename C >
   void Queue< T, C >::swap(Queue& rhs) noexcept(is_nothrow_swappable_v< C >)
   {
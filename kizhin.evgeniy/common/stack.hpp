@@ -32,6 +32,7 @@ namespace kizhin {
     template < typename... Args >
     void emplace(Args&&...);
 
+    void clear() noexcept;
     void swap(Stack&) noexcept(is_nothrow_swappable_v< Container >);
 
   private:
@@ -99,6 +100,12 @@ namespace kizhin {
     container_.emplaceFront(std::forward< Args >(args)...);
   }
 
+  template < typename T, typename C >
+  void Stack< T, C >::clear() noexcept
+  {
+    container_.clear();
+  }
+
   template < typename T, typename C >
   void Stack< T, C >::swap(Stack& rhs) noexcept(is_nothrow_swappable_v< C >)
   {
@@ -349,8 +349,7 @@ namespace kizhin {
     }
     const size_type capacity = bucketCount();
     Node* curr = begin_ + hashFunc()(key) % capacity;
-    const Node* const stop = curr == begin_ ? end_ : curr - 1;
-    while (curr != stop) {
+    for (size_type probes = 0; probes != capacity && curr->state != Node::empty; ++probes) {
       pointer currVal = reinterpret_cast< pointer >(curr->value);
       if (curr->state == Node::occupied && keyEq()(currVal->first, key)) {
         return const_iterator{ curr, end_ };
@@ -380,7 +379,7 @@ namespace kizhin {
     value_type value(std::forward< Args >(args)...);
     Node* curr = begin_ + hashFunc()(value.first) % capacity;
     Node* firstDeleted = nullptr;
-    while (curr->state != Node::empty) {
+    for (size_type probes = 0; probes != capacity && curr->state != Node::empty; ++probes) {
       pointer currVal = reinterpret_cast< pointer >(curr->value);
       if (curr->state == Node::occupied && keyEq()(currVal->first, value.first)) {
         return std::make_pair(iterator{ curr, end_ }, false);
@@ -0,0 +1,920 @@
+#ifndef SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_UNROLLED_FORWARD_LIST_HPP
+#define SPBSPU_LABS_2025_AADS_A_KIZHIN_EVGENIY_COMMON_UNROLLED_FORWARD_LIST_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <utility>
+#include "algorithm-utils.hpp"
+#include "buffer.hpp"
+#include "internal/node-pool.hpp"
+#include "internal/unrolled-forward-list-comparison.hpp"
+#include "internal/unrolled-forward-list-iterator.hpp"
+#include "internal/unrolled-forward-list-swap.hpp"
+#include "type-utils.hpp"
+
+namespace kizhin {
+  /*
+   * Forward list keeping up to BlockSize elements per node. Nodes come from a
+   * pool owned by the list, so filling it allocates O(size / BlockSize) times.
+   * Unlike ForwardList, insertion and erasure may move neighbouring elements
+   * of the same block, and splicing between lists moves elements instead of
+   * relinking nodes; both invalidate iterators past the affected position.
+   */
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  class UnrolledForwardList final
+  {
+    static_assert(BlockSize > 0, "UnrolledForwardList: empty blocks");
+
+  public:
+    using value_type = T;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using size_type = std::size_t;
+    using allocator_type = Allocator;
+    using iterator = detail::UnrolledForwardListIterator< value_type, BlockSize, false >;
+    using const_iterator = detail::UnrolledForwardListIterator< value_type, BlockSize, true >;
+
+    UnrolledForwardList();
+    explicit UnrolledForwardList(const allocator_type&);
+    UnrolledForwardList(const UnrolledForwardList&);
+    UnrolledForwardList(UnrolledForwardList&&) noexcept;
+    explicit UnrolledForwardList(size_type, const_reference = value_type(),
+        const allocator_type& = allocator_type());
+    template < typename InputIt, enable_if_input_iterator< InputIt > = 0 >
+    UnrolledForwardList(InputIt, InputIt, const allocator_type& = allocator_type());
+    UnrolledForwardList(std::initializer_list< value_type >,
+        const allocator_type& = allocator_type());
+    ~UnrolledForwardList();
+
+    UnrolledForwardList& operator=(const UnrolledForwardList&);
+    UnrolledForwardList& operator=(UnrolledForwardList&&) noexcept;
+    UnrolledForwardList& operator=(std::initializer_list< value_type >);
+
+    allocator_type getAllocator() const;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    iterator beforeBegin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+    const_iterator beforeBegin() const noexcept;
+
+    reference front() noexcept;
+    reference back() noexcept;
+    const_reference front() const noexcept;
+    const_reference back() const noexcept;
+    bool empty() const noexcept;
+    size_type size() const noexcept;
+
+    void pushBack(const_reference);
+    void pushBack(value_type&&);
+    void pushFront(const_reference);
+    void pushFront(value_type&&);
+    template < typename... Args >
+    void emplaceBack(Args&&...);
+    template < typename... Args >
+    void emplaceFront(Args&&...);
+    template < typename... Args >
+    iterator emplaceAfter(const_iterator, Args&&...);
+
+    void popBack() noexcept;
+    void popFront() noexcept;
+    iterator eraseAfter(const_iterator);
+    iterator eraseAfter(const_iterator, const_iterator);
+
+    void assign(size_type, const_reference);
+    template < typename InputIt, enable_if_input_iterator< InputIt > = 0 >
+    void assign(InputIt, InputIt);
+    void assign(std::initializer_list< value_type >);
+
+    iterator insertAfter(const_iterator, value_type);
+    iterator insertAfter(const_iterator, size_type, const_reference);
+    template < typename InputIt, enable_if_input_iterator< InputIt > = 0 >
+    iterator insertAfter(const_iterator, InputIt, InputIt);
+    iterator insertAfter(const_iterator, std::initializer_list< value_type >);
+
+    void clear() noexcept;
+    void swap(UnrolledForwardList&) noexcept;
+
+    void reverse() noexcept;
+    void spliceAfter(const_iterator, UnrolledForwardList&);
+    void spliceAfter(const_iterator, UnrolledForwardList&, const_iterator);
+    void spliceAfter(const_iterator, UnrolledForwardList&, const_iterator, const_iterator);
+
+    void remove(const_reference);
+    template < typename UnaryPredicate >
+    void removeIf(UnaryPredicate);
+
+    void unique();
+    template < typename BinaryPredicate >
+    void unique(BinaryPredicate);
+
+    void merge(UnrolledForwardList&);
+    template < typename Comparator >
+    void merge(UnrolledForwardList&, Comparator);
+
+    void sort();
+    template < typename Comparator >
+    void sort(Comparator);
+
+  private:
+    using BlockBase = detail::BlockBase;
+    using Block = detail::Block< value_type, BlockSize >;
+    using Pool = detail::NodePool< Block, Allocator >;
+    using ValueTraits = std::allocator_traits< Allocator >;
+
+    BlockBase head_;
+    BlockBase* tail_;
+    size_type size_;
+    allocator_type alloc_;
+    Pool pool_;
+
+    static pointer elementAt(BlockBase*, size_type) noexcept;
+    template < typename... Args >
+    void constructAt(BlockBase*, size_type, Args&&...);
+    void destroyTail(BlockBase*, size_type) noexcept;
+
+    BlockBase* createBlockAfter(BlockBase*);
+    void releaseBlockAfter(BlockBase*) noexcept;
+    BlockBase* findBlockBefore(BlockBase*) noexcept;
+
+    template < typename... Args >
+    iterator emplaceInNewBlock(BlockBase*, Args&&...);
+    template < typename... Args >
+    iterator emplaceInBlock(BlockBase*, size_type, Args&&...);
+    void eraseInBlock(BlockBase*, size_type, size_type) noexcept;
+    void splitBlock(BlockBase*, size_type);
+    const_iterator splitAfter(const_iterator);
+  };
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  UnrolledForwardList< T, BlockSize, Allocator >::UnrolledForwardList():
+    UnrolledForwardList(allocator_type())
+  {}
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  UnrolledForwardList< T, BlockSize, Allocator >::UnrolledForwardList(
+      const allocator_type& alloc):
+    head_{ nullptr, 1 },
+    tail_(std::addressof(head_)),
+    size_(0),
+    alloc_(alloc),
+    pool_(typename Pool::allocator_type(alloc_))
+  {}
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  UnrolledForwardList< T, BlockSize, Allocator >::UnrolledForwardList(
+      const UnrolledForwardList& rhs):
+    UnrolledForwardList(ValueTraits::select_on_container_copy_construction(rhs.alloc_))
+  {
+    insertAfter(beforeBegin(), rhs.begin(), rhs.end());
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  UnrolledForwardList< T, BlockSize, Allocator >::UnrolledForwardList(
+      UnrolledForwardList&& rhs) noexcept:
+    head_{ std::exchange(rhs.head_.next, nullptr), 1 },
+    tail_(rhs.tail_ == std::addressof(rhs.head_) ? std::addressof(head_) : rhs.tail_),
+    size_(std::exchange(rhs.size_, 0)),
+    alloc_(rhs.alloc_),
+    pool_(std::move(rhs.pool_))
+  {
+    rhs.tail_ = std::addressof(rhs.head_);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  UnrolledForwardList< T, BlockSize, Allocator >::UnrolledForwardList(size_type size,
+      const_reference value, const allocator_type& alloc):
+    UnrolledForwardList(alloc)
+  {
+    insertAfter(beforeBegin(), size, value);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  template < typename InputIt, enable_if_input_iterator< InputIt > >
+  UnrolledForwardList< T, BlockSize, Allocator >::UnrolledForwardList(InputIt first,
+      InputIt last, const allocator_type& alloc):
+    UnrolledForwardList(alloc)
+  {
+    insertAfter(beforeBegin(), first, last);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  UnrolledForwardList< T, BlockSize, Allocator >::UnrolledForwardList(
+      std::initializer_list< value_type > init, const allocator_type& alloc):
+    UnrolledForwardList(init.begin(), init.end(), alloc)
+  {}
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  UnrolledForwardList< T, BlockSize, Allocator >::~UnrolledForwardList()
+  {
+    clear();
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  UnrolledForwardList< T, BlockSize, Allocator >& UnrolledForwardList< T, BlockSize,
+      Allocator >::operator=(const UnrolledForwardList& rhs)
+  {
+    UnrolledForwardList tmp(rhs);
+    swap(tmp);
+    return *this;
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  UnrolledForwardList< T, BlockSize, Allocator >& UnrolledForwardList< T, BlockSize,
+      Allocator >::operator=(UnrolledForwardList&& rhs) noexcept
+  {
+    UnrolledForwardList tmp(std::move(rhs));
+    swap(tmp);
+    return *this;
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  UnrolledForwardList< T, BlockSize, Allocator >& UnrolledForwardList< T, BlockSize,
+      Allocator >::operator=(std::initializer_list< value_type > init)
+  {
+    UnrolledForwardList tmp(init, alloc_);
+    swap(tmp);
+    return *this;
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::allocator_type
+      UnrolledForwardList< T, BlockSize, Allocator >::getAllocator() const
+  {
+    return alloc_;
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::iterator UnrolledForwardList< T,
+      BlockSize, Allocator >::begin() noexcept
+  {
+    return iterator(head_.next, 0);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::iterator UnrolledForwardList< T,
+      BlockSize, Allocator >::end() noexcept
+  {
+    return iterator(nullptr, 0);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::iterator UnrolledForwardList< T,
+      BlockSize, Allocator >::beforeBegin() noexcept
+  {
+    return iterator(std::addressof(head_), 0);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::const_iterator
+      UnrolledForwardList< T, BlockSize, Allocator >::begin() const noexcept
+  {
+    return const_iterator(head_.next, 0);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::const_iterator
+      UnrolledForwardList< T, BlockSize, Allocator >::end() const noexcept
+  {
+    return const_iterator(nullptr, 0);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::const_iterator
+      UnrolledForwardList< T, BlockSize, Allocator >::beforeBegin() const noexcept
+  {
+    return const_iterator(const_cast< BlockBase* >(std::addressof(head_)), 0);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::reference UnrolledForwardList< T,
+      BlockSize, Allocator >::front() noexcept
+  {
+    assert(!empty() && "UnrolledForwardList: front() called on empty list");
+    return *elementAt(head_.next, 0);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::reference UnrolledForwardList< T,
+      BlockSize, Allocator >::back() noexcept
+  {
+    assert(!empty() && "UnrolledForwardList: back() called on empty list");
+    return *elementAt(tail_, tail_->size - 1);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::const_reference
+      UnrolledForwardList< T, BlockSize, Allocator >::front() const noexcept
+  {
+    assert(!empty() && "UnrolledForwardList: front() called on empty list");
+    return *elementAt(head_.next, 0);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::const_reference
+      UnrolledForwardList< T, BlockSize, Allocator >::back() const noexcept
+  {
+    assert(!empty() && "UnrolledForwardList: back() called on empty list");
+    return *elementAt(tail_, tail_->size - 1);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  bool UnrolledForwardList< T, BlockSize, Allocator >::empty() const noexcept
+  {
+    return size_ == 0;
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::size_type UnrolledForwardList< T,
+      BlockSize, Allocator >::size() const noexcept
+  {
+    return size_;
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::pushBack(const_reference value)
+  {
+    emplaceBack(value);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::pushBack(value_type&& value)
+  {
+    emplaceBack(std::move(value));
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::pushFront(const_reference value)
+  {
+    emplaceFront(value);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::pushFront(value_type&& value)
+  {
+    emplaceFront(std::move(value));
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  template < typename... Args >
+  void UnrolledForwardList< T, BlockSize, Allocator >::emplaceBack(Args&&... args)
+  {
+    if (tail_ != std::addressof(head_) && tail_->size != BlockSize) {
+      emplaceInBlock(tail_, tail_->size, std::forward< Args >(args)...);
+    } else {
+      emplaceInNewBlock(tail_, std::forward< Args >(args)...);
+    }
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  template < typename... Args >
+  void UnrolledForwardList< T, BlockSize, Allocator >::emplaceFront(Args&&... args)
+  {
+    if (head_.next != nullptr && head_.next->size != BlockSize) {
+      emplaceInBlock(head_.next, 0, std::forward< Args >(args)...);
+    } else {
+      emplaceInNewBlock(std::addressof(head_), std::forward< Args >(args)...);
+    }
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  template < typename... Args >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::iterator UnrolledForwardList< T,
+      BlockSize, Allocator >::emplaceAfter(const_iterator position, Args&&... args)
+  {
+    assert(position != end() && "UnrolledForwardList: emplaceAfter called with end iterator");
+    BlockBase* block = position.block_;
+    const size_type index = position.index_ + 1;
+    if (block == std::addressof(head_)) {
+      emplaceFront(std::forward< Args >(args)...);
+      return begin();
+    }
+    if (block->size != BlockSize) {
+      return emplaceInBlock(block, index, std::forward< Args >(args)...);
+    }
+    if (index == BlockSize) {
+      return emplaceInNewBlock(block, std::forward< Args >(args)...);
+    }
+    value_type value(std::forward< Args >(args)...);
+    splitBlock(block, index);
+    return emplaceInBlock(block, index, std::move(value));
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::popBack() noexcept
+  {
+    assert(!empty() && "UnrolledForwardList: popBack() called on empty list");
+    BlockBase* last = tail_;
+    destroyTail(last, last->size - 1);
+    if (last->size == 0) {
+      releaseBlockAfter(findBlockBefore(last));
+    }
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::popFront() noexcept
+  {
+    assert(!empty() && "UnrolledForwardList: popFront() called on empty list");
+    eraseInBlock(head_.next, 0, 1);
+    if (head_.next->size == 0) {
+      releaseBlockAfter(std::addressof(head_));
+    }
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::iterator UnrolledForwardList< T,
+      BlockSize, Allocator >::eraseAfter(const_iterator position)
+  {
+    assert(!empty() && "UnrolledForwardList: cannot erase from empty list");
+    assert(position != end() && "UnrolledForwardList: cannot erase after end iterator");
+    assert(std::next(position) != end() &&
+           "UnrolledForwardList: cannot erase after last element");
+    return eraseAfter(position, std::next(position, 2));
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::iterator UnrolledForwardList< T,
+      BlockSize, Allocator >::eraseAfter(const_iterator first, const_iterator last)
+  {
+    assert(!empty() && "UnrolledForwardList: cannot erase from empty list");
+    assert(first != last && "UnrolledForwardList: empty erase range (first, last)");
+    BlockBase* firstBlock = first.block_;
+    BlockBase* lastBlock = last.block_;
+    if (firstBlock == lastBlock) {
+      eraseInBlock(firstBlock, first.index_ + 1, last.index_);
+      return iterator(firstBlock, first.index_);
+    }
+    if (firstBlock != std::addressof(head_)) {
+      destroyTail(firstBlock, first.index_ + 1);
+    }
+    while (firstBlock->next != lastBlock) {
+      destroyTail(firstBlock->next, 0);
+      releaseBlockAfter(firstBlock);
+    }
+    if (lastBlock != nullptr) {
+      eraseInBlock(lastBlock, 0, last.index_);
+    }
+    return iterator(firstBlock, first.index_);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::assign(size_type size,
+      const_reference value)
+  {
+    UnrolledForwardList tmp(size, value, alloc_);
+    swap(tmp);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  template < typename InputIt, enable_if_input_iterator< InputIt > >
+  void UnrolledForwardList< T, BlockSize, Allocator >::assign(InputIt first, InputIt last)
+  {
+    UnrolledForwardList tmp(first, last, alloc_);
+    swap(tmp);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::assign(
+      std::initializer_list< value_type > init)
+  {
+    UnrolledForwardList tmp(init, alloc_);
+    swap(tmp);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::iterator UnrolledForwardList< T,
+      BlockSize, Allocator >::insertAfter(const_iterator position, value_type value)
+  {
+    assert(position != end() && "UnrolledForwardList: insertAfter called with end iterator");
+    return emplaceAfter(position, std::move(value));
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::iterator UnrolledForwardList< T,
+      BlockSize, Allocator >::insertAfter(const_iterator position, size_type size,
+      const_reference value)
+  {
+    assert(position != end() && "UnrolledForwardList: insertAfter called with end iterator");
+    if (size == 0) {
+      return iterator(position.block_, position.index_);
+    }
+    const value_type copy(value);
+    position = splitAfter(position);
+    iterator result = emplaceAfter(position, copy);
+    position = result;
+    for (size_type i = 1; i != size; ++i) {
+      position = emplaceAfter(position, copy);
+    }
+    return result;
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  template < typename InputIt, enable_if_input_iterator< InputIt > >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::iterator UnrolledForwardList< T,
+      BlockSize, Allocator >::insertAfter(const_iterator position, InputIt first, InputIt last)
+  {
+    assert(position != end() && "UnrolledForwardList: insertAfter called with end iterator");
+    if (first == last) {
+      return iterator(position.block_, position.index_);
+    }
+    position = splitAfter(position);
+    iterator result = emplaceAfter(position, *first);
+    position = result;
+    ++first;
+    for (; first != last; ++first) {
+      position = emplaceAfter(position, *first);
+    }
+    return result;
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::iterator UnrolledForwardList< T,
+      BlockSize, Allocator >::insertAfter(const_iterator position,
+      std::initializer_list< value_type > init)
+  {
+    assert(position != end() && "UnrolledForwardList: insertAfter called with end iterator");
+    return insertAfter(position, init.begin(), init.end());
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::clear() noexcept
+  {
+    while (head_.next != nullptr) {
+      destroyTail(head_.next, 0);
+      releaseBlockAfter(std::addressof(head_));
+    }
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::swap(UnrolledForwardList& rhs) noexcept
+  {
+    using std::swap;
+    const bool isEmpty = tail_ == std::addressof(head_);
+    const bool isRhsEmpty = rhs.tail_ == std::addressof(rhs.head_);
+    swap(head_.next, rhs.head_.next);
+    swap(tail_, rhs.tail_);
+    if (isEmpty) {
+      rhs.tail_ = std::addressof(rhs.head_);
+    }
+    if (isRhsEmpty) {
+      tail_ = std::addressof(head_);
+    }
+    swap(size_, rhs.size_);
+    swap(alloc_, rhs.alloc_);
+    pool_.swap(rhs.pool_);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::reverse() noexcept
+  {
+    BlockBase* prev = nullptr;
+    BlockBase* curr = head_.next;
+    if (curr != nullptr) {
+      tail_ = curr;
+    }
+    while (curr) {
+      std::reverse(elementAt(curr, 0), elementAt(curr, curr->size));
+      BlockBase* next = curr->next;
+      curr->next = prev;
+      prev = curr;
+      curr = next;
+    }
+    head_.next = prev;
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::spliceAfter(const_iterator position,
+      UnrolledForwardList& source)
+  {
+    if (source.empty()) {
+      return;
+    }
+    if (empty() && alloc_ == source.alloc_) {
+      swap(source);
+      return;
+    }
+    spliceAfter(position, source, source.beforeBegin(), source.end());
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::spliceAfter(const_iterator position,
+      UnrolledForwardList& source, const_iterator sourcePosition)
+  {
+    spliceAfter(position, source, sourcePosition, std::next(sourcePosition, 2));
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::spliceAfter(const_iterator position,
+      UnrolledForwardList& source, const_iterator first, const_iterator last)
+  {
+    if (first == last || std::next(first) == last || std::addressof(source) == this) {
+      return;
+    }
+    const iterator from(first.block_, first.index_);
+    const iterator to(last.block_, last.index_);
+    insertAfter(position, std::make_move_iterator(std::next(from)),
+        std::make_move_iterator(to));
+    source.eraseAfter(first, last);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::remove(const_reference value)
+  {
+    const value_type copy(value);
+    const auto pred = [&copy](const_reference rhs) -> bool
+    {
+      return copy == rhs;
+    };
+    removeIf(pred);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  template < typename UnaryPredicate >
+  void UnrolledForwardList< T, BlockSize, Allocator >::removeIf(UnaryPredicate p)
+  {
+    BlockBase* prev = std::addressof(head_);
+    while (prev->next != nullptr) {
+      BlockBase* curr = prev->next;
+      size_type kept = 0;
+      for (size_type i = 0; i != curr->size; ++i) {
+        pointer element = elementAt(curr, i);
+        bool isRemoved = false;
+        try {
+          isRemoved = p(*element);
+        } catch (...) {
+          moveRange(element, elementAt(curr, curr->size), elementAt(curr, kept));
+          destroyTail(curr, kept + curr->size - i);
+          throw;
+        }
+        if (!isRemoved) {
+          if (kept != i) {
+            *elementAt(curr, kept) = std::move(*element);
+          }
+          ++kept;
+        }
+      }
+      destroyTail(curr, kept);
+      if (kept == 0) {
+        releaseBlockAfter(prev);
+      } else {
+        prev = curr;
+      }
+    }
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::unique()
+  {
+    return unique(std::equal_to< value_type >{});
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  template < typename BinaryPredicate >
+  void UnrolledForwardList< T, BlockSize, Allocator >::unique(BinaryPredicate p)
+  {
+    if (empty()) {
+      return;
+    }
+    pointer last = elementAt(head_.next, 0);
+    BlockBase* prev = std::addressof(head_);
+    size_type start = 1;
+    while (prev->next != nullptr) {
+      BlockBase* curr = prev->next;
+      size_type kept = start;
+      for (size_type i = start; i != curr->size; ++i) {
+        pointer element = elementAt(curr, i);
+        if (!p(*last, *element)) {
+          if (kept != i) {
+            *elementAt(curr, kept) = std::move(*element);
+          }
+          last = elementAt(curr, kept);
+          ++kept;
+        }
+      }
+      destroyTail(curr, kept);
+      if (kept == 0) {
+        releaseBlockAfter(prev);
+      } else {
+        prev = curr;
+      }
+      start = 0;
+    }
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::merge(UnrolledForwardList& source)
+  {
+    merge(source, std::less< value_type >{});
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  template < typename Comparator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::merge(UnrolledForwardList& source,
+      Comparator comp)
+  {
+    if (this == std::addressof(source) || source.empty()) {
+      return;
+    }
+    if (empty()) {
+      swap(source);
+      return;
+    }
+    iterator thisCurr = begin();
+    iterator sourceCurr = source.begin();
+    UnrolledForwardList result(alloc_);
+    while (thisCurr != end() && sourceCurr != source.end()) {
+      if (comp(*sourceCurr, *thisCurr)) {
+        result.emplaceBack(std::move(*sourceCurr));
+        ++sourceCurr;
+      } else {
+        result.emplaceBack(std::move(*thisCurr));
+        ++thisCurr;
+      }
+    }
+    for (; thisCurr != end(); ++thisCurr) {
+      result.emplaceBack(std::move(*thisCurr));
+    }
+    for (; sourceCurr != source.end(); ++sourceCurr) {
+      result.emplaceBack(std::move(*sourceCurr));
+    }
+    source.clear();
+    swap(result);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::sort()
+  {
+    return sort(std::less< value_type >{});
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  template < typename Comparator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::sort(Comparator comp)
+  {
+    if (size_ <= 1) {
+      return;
+    }
+    Buffer< value_type > sorted(std::make_move_iterator(begin()), std::make_move_iterator(end()));
+    std::stable_sort(sorted.begin(), sorted.end(), comp);
+    moveRange(sorted.begin(), sorted.end(), begin());
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::pointer UnrolledForwardList< T,
+      BlockSize, Allocator >::elementAt(BlockBase* block, size_type index) noexcept
+  {
+    return static_cast< Block* >(block)->data(index);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  template < typename... Args >
+  void UnrolledForwardList< T, BlockSize, Allocator >::constructAt(BlockBase* block,
+      size_type index, Args&&... args)
+  {
+    ValueTraits::construct(alloc_, elementAt(block, index), std::forward< Args >(args)...);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::destroyTail(BlockBase* block,
+      size_type newSize) noexcept
+  {
+    assert(newSize <= block->size && "UnrolledForwardList: growing block on destroy");
+    for (size_type i = newSize; i != block->size; ++i) {
+      ValueTraits::destroy(alloc_, elementAt(block, i));
+    }
+    size_ -= block->size - newSize;
+    block->size = newSize;
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::BlockBase* UnrolledForwardList< T,
+      BlockSize, Allocator >::createBlockAfter(BlockBase* prev)
+  {
+    Block* block = ::new (static_cast< void* >(pool_.allocate())) Block;
+    block->next = prev->next;
+    block->size = 0;
+    prev->next = block;
+    if (tail_ == prev) {
+      tail_ = block;
+    }
+    return block;
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::releaseBlockAfter(
+      BlockBase* prev) noexcept
+  {
+    Block* block = static_cast< Block* >(prev->next);
+    assert(block->size == 0 && "UnrolledForwardList: releasing non-empty block");
+    prev->next = block->next;
+    if (tail_ == block) {
+      tail_ = prev;
+    }
+    block->~Block();
+    pool_.deallocate(block);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::BlockBase* UnrolledForwardList< T,
+      BlockSize, Allocator >::findBlockBefore(BlockBase* block) noexcept
+  {
+    BlockBase* prev = std::addressof(head_);
+    while (prev->next != block) {
+      prev = prev->next;
+    }
+    return prev;
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  template < typename... Args >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::iterator UnrolledForwardList< T,
+      BlockSize, Allocator >::emplaceInNewBlock(BlockBase* prev, Args&&... args)
+  {
+    BlockBase* block = createBlockAfter(prev);
+    try {
+      constructAt(block, 0, std::forward< Args >(args)...);
+    } catch (...) {
+      releaseBlockAfter(prev);
+      throw;
+    }
+    block->size = 1;
+    ++size_;
+    return iterator(block, 0);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  template < typename... Args >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::iterator UnrolledForwardList< T,
+      BlockSize, Allocator >::emplaceInBlock(BlockBase* block, size_type index, Args&&... args)
+  {
+    assert(block->size < BlockSize && "UnrolledForwardList: emplacing in full block");
+    assert(index <= block->size && "UnrolledForwardList: emplacing past block end");
+    if (index == block->size) {
+      constructAt(block, index, std::forward< Args >(args)...);
+    } else {
+      value_type value(std::forward< Args >(args)...);
+      const size_type last = block->size - 1;
+      constructAt(block, block->size, std::move(*elementAt(block, last)));
+      moveBackward(elementAt(block, index), elementAt(block, last), elementAt(block, block->size));
+      *elementAt(block, index) = std::move(value);
+    }
+    ++block->size;
+    ++size_;
+    return iterator(block, index);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::eraseInBlock(BlockBase* block,
+      size_type first, size_type last) noexcept
+  {
+    if (first == last) {
+      return;
+    }
+    moveRange(elementAt(block, last), elementAt(block, block->size), elementAt(block, first));
+    destroyTail(block, block->size - (last - first));
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  void UnrolledForwardList< T, BlockSize, Allocator >::splitBlock(BlockBase* block,
+      size_type index)
+  {
+    assert(index < block->size && "UnrolledForwardList: splitting past block end");
+    BlockBase* next = createBlockAfter(block);
+    const size_type count = block->size - index;
+    size_type moved = 0;
+    try {
+      for (; moved != count; ++moved) {
+        constructAt(next, moved, std::move(*elementAt(block, index + moved)));
+      }
+    } catch (...) {
+      for (size_type i = 0; i != moved; ++i) {
+        ValueTraits::destroy(alloc_, elementAt(next, i));
+      }
+      releaseBlockAfter(block);
+      throw;
+    }
+    next->size = count;
+    size_ += count;
+    destroyTail(block, index);
+  }
+
+  template < typename T, std::size_t BlockSize, typename Allocator >
+  typename UnrolledForwardList< T, BlockSize, Allocator >::const_iterator
+      UnrolledForwardList< T, BlockSize, Allocator >::splitAfter(const_iterator position)
+  {
+    BlockBase* block = position.block_;
+    const size_type index = position.index_ + 1;
+    if (block != std::addressof(head_) && index != block->size) {
+      splitBlock(block, index);
+    }
+    return position;
+  }
+}
+
+#endif
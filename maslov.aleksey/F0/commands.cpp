@@ -89,9 +89,10 @@ void maslov::loadText(std::istream & in, Dicts & dicts)
     throw std::runtime_error("<INVALID DICTIONARY>");
   }
   std::string word;
+  std::string realWord;
   while (file >> word)
   {
-    std::string realWord;
+    realWord.clear();
     for (char c: word)
     {
       if (isAlpha(c))
@@ -3,11 +3,12 @@
 
 #include <iosfwd>
 #include <hashTable/hashTable.hpp>
+#include <hashTable/stringHash.hpp>
 
 namespace maslov
 {
-  using Dict = HashTable< std::string, int >;
-  using Dicts = HashTable< std::string, Dict >;
+  using Dict = HashTable< std::string, int, detail::StringHash1, detail::StringHash2, detail::StringEqual >;
+  using Dicts = HashTable< std::string, Dict, detail::StringHash1, detail::StringHash2, detail::StringEqual >;
 
   void createDictionary(std::istream & in, Dicts & dicts);
   void showDictionary(std::ostream & out, const Dicts & dicts);
@@ -10,7 +10,7 @@
 int main(int argc, char * argv[])
 {
   using namespace maslov;
-  HashTable< std::string, HashTable< std::string, int > > dicts;
+  Dicts dicts;
   if (argc == 2)
   {
     if (std::string(argv[1]) == "--help")
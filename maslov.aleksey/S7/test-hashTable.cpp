@@ -1,6 +1,10 @@
 #include <boost/test/unit_test.hpp>
+#include <memory>
+#include <random>
 #include <sstream>
+#include <unordered_map>
 #include <hashTable/hashTable.hpp>
+#include <hashTable/stringHash.hpp>
 
 namespace
 {
@@ -18,6 +22,50 @@ namespace
       out << ' ' << it->first << ' ' << it->second;
     }
   }
+
+  template< class Table >
+  bool fuzzAgainstStd(unsigned seed)
+  {
+    Table hashTable;
+    std::unordered_map< std::string, int > expected;
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution< int > keys(0, 299);
+    std::uniform_int_distribution< int > ops(0, 3);
+    bool same = true;
+    for (int i = 0; i < 20000; ++i)
+    {
+      std::string key = "key" + std::to_string(keys(gen));
+      switch (ops(gen))
+      {
+      case 0:
+      case 1:
+        hashTable[key] += i;
+        expected[key] += i;
+        break;
+      case 2:
+        same = same && hashTable.erase(key) == expected.erase(key);
+        break;
+      default:
+      {
+        auto it = hashTable.find(key);
+        auto expectedIt = expected.find(key);
+        bool found = it != hashTable.end();
+        same = same && found == (expectedIt != expected.end());
+        same = same && (!found || it->second == expectedIt->second);
+      }
+      }
+      same = same && hashTable.size() == expected.size();
+    }
+    const Table copy(hashTable);
+    std::unordered_map< std::string, int > actual(copy.cbegin(), copy.cend());
+    same = same && actual == expected;
+    for (const auto & pair: expected)
+    {
+      auto it = copy.find(pair.first);
+      same = same && it != copy.cend() && it->second == pair.second;
+    }
+    return same;
+  }
 }
 
 BOOST_AUTO_TEST_SUITE(constructors)
@@ -236,6 +284,24 @@ BOOST_AUTO_TEST_CASE(erase)
   BOOST_TEST(out3.str() == "4 four");
 }
 
+BOOST_AUTO_TEST_CASE(eraseChurn)
+{
+  maslov::HashTable< int, std::shared_ptr< int > > hashTable;
+  std::shared_ptr< int > value = std::make_shared< int >(0);
+  size_t erased = 0;
+  for (int i = 0; i < 1000; ++i)
+  {
+    hashTable.insert(i, value);
+    erased += hashTable.erase(i);
+  }
+  BOOST_TEST(erased == 1000);
+  BOOST_TEST(hashTable.empty());
+  BOOST_TEST(value.use_count() == 1);
+  hashTable.insert(-1, value);
+  BOOST_TEST(hashTable.loadFactor() == 0.1f);
+  BOOST_TEST((hashTable.find(999) == hashTable.end()));
+}
+
 BOOST_AUTO_TEST_CASE(swap)
 {
   maslov::HashTable< int, std::string > hashTable1;
@@ -289,4 +355,50 @@ BOOST_AUTO_TEST_CASE(find)
   BOOST_TEST(check2);
 }
 
+BOOST_AUTO_TEST_CASE(rehashKeepsElements)
+{
+  maslov::HashTable< int, int > hashTable;
+  for (int i = 0; i < 500; ++i)
+  {
+    hashTable.insert(i, i * 3);
+  }
+  BOOST_TEST(hashTable.size() == 500);
+  bool allFound = true;
+  for (int i = 0; i < 500; ++i)
+  {
+    auto it = hashTable.find(i);
+    allFound = allFound && it != hashTable.end() && it->second == i * 3;
+  }
+  BOOST_TEST(allFound);
+}
+
+BOOST_AUTO_TEST_CASE(eraseKeepsProbeChains)
+{
+  using namespace maslov::detail;
+  BOOST_TEST((fuzzAgainstStd< maslov::HashTable< std::string, int > >(29)));
+  BOOST_TEST((fuzzAgainstStd< maslov::HashTable< std::string, int, StringHash1, StringHash2, StringEqual > >(47)));
+}
+
+BOOST_AUTO_TEST_CASE(transparentLookup)
+{
+  using namespace maslov::detail;
+  maslov::HashTable< std::string, int, StringHash1, StringHash2, StringEqual > hashTable;
+  for (int i = 0; i < 100; ++i)
+  {
+    hashTable[std::to_string(i)] = i;
+  }
+  const char * key = "42";
+  BOOST_TEST(hashTable.at(key) == 42);
+  bool found = hashTable.find(key) == hashTable.find(std::string("42"));
+  BOOST_TEST(found);
+  char buffer[] = {'1', '7', '\0'};
+  const auto & constTable = hashTable;
+  BOOST_TEST(constTable.at(static_cast< const char * >(buffer)) == 17);
+  BOOST_TEST(hashTable.erase("17") == 1);
+  BOOST_TEST(hashTable.erase("17") == 0);
+  bool erased = hashTable.find("17") == hashTable.end();
+  BOOST_TEST(erased);
+  BOOST_CHECK_THROW(hashTable.at("100"), std::out_of_range);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
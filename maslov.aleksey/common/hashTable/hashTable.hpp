@@ -1,12 +1,37 @@
 #ifndef HASH_TABLE_HPP
 #define HASH_TABLE_HPP
 
+#include <string>
+#include <type_traits>
 #include <boost/hash2/xxhash.hpp>
 #include "iterator.hpp"
 #include "hashNode.hpp"
 
 namespace maslov::detail
 {
+  template< class F, class = void >
+  struct IsTransparent: std::false_type
+  {};
+
+  template< class F >
+  struct IsTransparent< F, typename std::conditional< true, void, typename F::is_transparent >::type >: std::true_type
+  {};
+
+  template< class HS1, class HS2, class EQ, class K >
+  using EnableTransparent = typename std::enable_if< IsTransparent< HS1 >::value && IsTransparent< HS2 >::value
+      && IsTransparent< EQ >::value, K >::type;
+
+  inline size_t gcd(size_t a, size_t b) noexcept
+  {
+    while (b != 0)
+    {
+      size_t tmp = a % b;
+      a = b;
+      b = tmp;
+    }
+    return a;
+  }
+
   template< class Key >
   struct XXHash
   {
@@ -17,6 +42,17 @@ namespace maslov::detail
       return hasher.result();
     }
   };
+
+  template<>
+  struct XXHash< std::string >
+  {
+    size_t operator()(const std::string & key) const
+    {
+      boost::hash2::xxhash_64 hasher;
+      hasher.update(key.data(), key.size());
+      return hasher.result();
+    }
+  };
 }
 
 namespace maslov
@@ -45,6 +81,14 @@ namespace maslov
     T & operator[](Key && key);
     iterator find(const Key & key) noexcept;
     cIterator find(const Key & key) const noexcept;
+    template< class K, class = detail::EnableTransparent< HS1, HS2, EQ, K > >
+    T & at(const K & key);
+    template< class K, class = detail::EnableTransparent< HS1, HS2, EQ, K > >
+    const T & at(const K & key) const;
+    template< class K, class = detail::EnableTransparent< HS1, HS2, EQ, K > >
+    iterator find(const K & key) noexcept;
+    template< class K, class = detail::EnableTransparent< HS1, HS2, EQ, K > >
+    cIterator find(const K & key) const noexcept;
 
     bool empty() const noexcept;
     size_t size() const noexcept;
@@ -64,6 +108,8 @@ namespace maslov
     template< class InputIt >
     iterator erase(InputIt first, InputIt last);
     size_t erase(const Key & key);
+    template< class K, class = detail::EnableTransparent< HS1, HS2, EQ, K > >
+    size_t erase(const K & key);
     void clear() noexcept;
 
     iterator begin() noexcept;
@@ -81,9 +127,14 @@ namespace maslov
     HashNode< Key, T > * slots_;
     size_t capacity_;
     size_t size_;
+    size_t deleted_;
     float maxLoadFactor_= 0.7f;
-    std::pair< size_t, size_t > calculatePositions(const Key & key) const noexcept;
-    std::pair< size_t, bool > findPosition(const Key & key) const noexcept;
+    template< class K >
+    std::pair< size_t, size_t > calculatePositions(const K & key) const noexcept;
+    template< class K >
+    std::pair< size_t, bool > findPosition(const K & key) const noexcept;
+    template< class K >
+    size_t findIndex(const K & key) const noexcept;
   };
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -95,7 +146,8 @@ namespace maslov
   HashTable< Key, T, HS1, HS2, EQ >::HashTable(size_t capacity):
     slots_(new HashNode< Key, T >[capacity]),
     capacity_(capacity),
-    size_(0)
+    size_(0),
+    deleted_(0)
   {}
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -121,11 +173,12 @@ namespace maslov
   HashTable< Key, T, HS1, HS2, EQ >::HashTable(const HashTable & rhs):
     slots_(new HashNode< Key, T >[rhs.capacity_]),
     capacity_(rhs.capacity_),
-    size_(rhs.size_)
+    size_(rhs.size_),
+    deleted_(rhs.deleted_)
   {
     for (size_t i = 0; i < capacity_; ++i)
     {
-      if (rhs.slots_[i].occupied && !rhs.slots_[i].deleted)
+      if (rhs.slots_[i].occupied)
       {
         slots_[i] = rhs.slots_[i];
       }
@@ -136,11 +189,13 @@ namespace maslov
   HashTable< Key, T, HS1, HS2, EQ >::HashTable(HashTable && rhs) noexcept:
     slots_(rhs.slots_),
     capacity_(rhs.capacity_),
-    size_(rhs.size_)
+    size_(rhs.size_),
+    deleted_(rhs.deleted_)
   {
     rhs.slots_ = nullptr;
     rhs.capacity_ = 0;
     rhs.size_ = 0;
+    rhs.deleted_ = 0;
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -163,9 +218,11 @@ namespace maslov
       slots_ = rhs.slots_;
       capacity_ = rhs.capacity_;
       size_ = rhs.size_;
+      deleted_ = rhs.deleted_;
       rhs.slots_ = nullptr;
       rhs.capacity_ = 0;
       rhs.size_ = 0;
+      rhs.deleted_ = 0;
     }
     return *this;
   }
@@ -191,31 +248,25 @@ namespace maslov
   template< class Key, class T, class HS1, class HS2, class EQ >
   void HashTable< Key, T, HS1, HS2, EQ >::rehash(size_t newCapacity)
   {
-    if (newCapacity <= capacity_)
+    if (newCapacity < capacity_)
     {
       return;
     }
-    HashNode< Key, T > * tmp = nullptr;
-    try
+    HashTable tmp(newCapacity);
+    for (size_t i = 0; i < capacity_; ++i)
     {
-      tmp = new HashNode< Key, T >[newCapacity];
-      for (size_t i = 0; i < capacity_; ++i)
+      if (slots_[i].occupied && !slots_[i].deleted)
       {
-        if (slots_[i].occupied && !slots_[i].deleted)
+        size_t pos = tmp.findPosition(slots_[i].data.first).first;
+        if (pos == newCapacity)
         {
-          auto pos = findPosition(slots_[i].data.first);
-          tmp[pos.first] = slots_[i];
+          throw std::runtime_error("ERROR: hash table is full");
         }
+        tmp.slots_[pos] = std::move(slots_[i]);
+        tmp.size_++;
       }
     }
-    catch (const std::exception &)
-    {
-      delete[] tmp;
-      throw;
-    }
-    delete[] slots_;
-    slots_ = std::move(tmp);
-    capacity_ = newCapacity;
+    swap(tmp);
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -225,15 +276,21 @@ namespace maslov
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
-  std::pair< size_t, size_t > HashTable< Key, T, HS1, HS2, EQ >::calculatePositions(const Key & key) const noexcept
+  template< class K >
+  std::pair< size_t, size_t > HashTable< Key, T, HS1, HS2, EQ >::calculatePositions(const K & key) const noexcept
   {
     size_t h1 = HS1{}(key) % capacity_;
     size_t h2 = HS2{}(key) % (capacity_ - 1) + 1;
+    while (detail::gcd(h2, capacity_) != 1)
+    {
+      h2 = h2 % (capacity_ - 1) + 1;
+    }
     return {h1, h2};
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
-  std::pair< size_t, bool > HashTable< Key, T, HS1, HS2, EQ >::findPosition(const Key & key) const noexcept
+  template< class K >
+  std::pair< size_t, bool > HashTable< Key, T, HS1, HS2, EQ >::findPosition(const K & key) const noexcept
   {
     auto pos = calculatePositions(key);
     size_t deleted = capacity_;
@@ -251,16 +308,19 @@ namespace maslov
           return {index, true};
         }
       }
-      else if (slots_[index].deleted && deleted == capacity_)
+      else if (slots_[index].deleted)
       {
-        deleted = index;
+        if (deleted == capacity_)
+        {
+          deleted = index;
+        }
       }
       else if (EQ{}(slots_[index].data.first, key))
       {
         return {index, false};
       }
     }
-    return {capacity_, false};
+    return {deleted, deleted != capacity_};
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -288,29 +348,43 @@ namespace maslov
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
-  HashIterator< Key, T, HS1, HS2, EQ > HashTable< Key, T, HS1, HS2, EQ >::find(const Key & key) noexcept
+  template< class K >
+  size_t HashTable< Key, T, HS1, HS2, EQ >::findIndex(const K & key) const noexcept
   {
     auto pair = findPosition(key);
     size_t pos = pair.first;
     bool hasFind = pair.second;
     if (hasFind || pos == capacity_)
     {
-      return end();
+      return capacity_;
     }
-    return iterator(slots_, capacity_, pos);
+    return pos;
+  }
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  HashIterator< Key, T, HS1, HS2, EQ > HashTable< Key, T, HS1, HS2, EQ >::find(const Key & key) noexcept
+  {
+    return iterator(slots_, capacity_, findIndex(key));
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
   HashConstIterator< Key, T, HS1, HS2, EQ > HashTable<Key, T, HS1, HS2, EQ >::find(const Key & key) const noexcept
   {
-    auto pair = findPosition(key);
-    size_t pos = pair.first;
-    bool hasFind = pair.second;
-    if (hasFind || pos == capacity_)
-    {
-      return cend();
-    }
-    return cIterator(slots_, capacity_, pos);
+    return cIterator(slots_, capacity_, findIndex(key));
+  }
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  template< class K, class >
+  HashIterator< Key, T, HS1, HS2, EQ > HashTable< Key, T, HS1, HS2, EQ >::find(const K & key) noexcept
+  {
+    return iterator(slots_, capacity_, findIndex(key));
+  }
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  template< class K, class >
+  HashConstIterator< Key, T, HS1, HS2, EQ > HashTable< Key, T, HS1, HS2, EQ >::find(const K & key) const noexcept
+  {
+    return cIterator(slots_, capacity_, findIndex(key));
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -335,9 +409,38 @@ namespace maslov
     return it->second;
   }
 
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  template< class K, class >
+  T & HashTable< Key, T, HS1, HS2, EQ >::at(const K & key)
+  {
+    auto it = find(key);
+    if (it == end())
+    {
+      throw std::out_of_range("ERROR: key not found");
+    }
+    return it->second;
+  }
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  template< class K, class >
+  const T & HashTable< Key, T, HS1, HS2, EQ >::at(const K & key) const
+  {
+    auto it = find(key);
+    if (it == cend())
+    {
+      throw std::out_of_range("ERROR: key not found");
+    }
+    return it->second;
+  }
+
   template< class Key, class T, class HS1, class HS2, class EQ >
   T & HashTable< Key, T, HS1, HS2, EQ >::operator[](const Key & key)
   {
+    auto it = find(key);
+    if (it != end())
+    {
+      return it->second;
+    }
     auto result = insert(key, T{});
     return result.first->second;
   }
@@ -345,7 +448,12 @@ namespace maslov
   template< class Key, class T, class HS1, class HS2, class EQ >
   T & HashTable< Key, T, HS1, HS2, EQ >::operator[](Key && key)
   {
-    auto result = insert(std::move(key), T{});
+    auto it = find(key);
+    if (it != end())
+    {
+      return it->second;
+    }
+    auto result = emplace(std::move(key), T{});
     return result.first->second;
   }
 
@@ -354,10 +462,15 @@ namespace maslov
   {
     for (size_t i = 0; i < capacity_; i++)
     {
+      if (slots_[i].occupied)
+      {
+        slots_[i].data = std::pair< Key, T >();
+      }
       slots_[i].occupied = false;
       slots_[i].deleted = false;
     }
     size_ = 0;
+    deleted_ = 0;
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -368,9 +481,10 @@ namespace maslov
       return end();
     }
     size_t index = pos.current_;
-    slots_[index].occupied = false;
+    slots_[index].data = std::pair< Key, T >();
     slots_[index].deleted = true;
     size_--;
+    deleted_++;
     return iterator(slots_, capacity_, index);
   }
 
@@ -404,12 +518,26 @@ namespace maslov
     return 0;
   }
 
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  template< class K, class >
+  size_t HashTable< Key, T, HS1, HS2, EQ >::erase(const K & key)
+  {
+    auto it = find(key);
+    if (it != end())
+    {
+      erase(it);
+      return 1;
+    }
+    return 0;
+  }
+
   template< class Key, class T, class HS1, class HS2, class EQ >
   void HashTable< Key, T, HS1, HS2, EQ >::swap(HashTable & rhs) noexcept
   {
     std::swap(slots_, rhs.slots_);
     std::swap(capacity_, rhs.capacity_);
     std::swap(size_, rhs.size_);
+    std::swap(deleted_, rhs.deleted_);
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -445,9 +573,9 @@ namespace maslov
   template< class... Args >
   std::pair< HashIterator< Key, T, HS1, HS2, EQ >, bool > HashTable< Key, T, HS1, HS2, EQ >::emplace(Args &&... args)
   {
-    if (loadFactor() >= maxLoadFactor_)
+    if (static_cast< float >(size_ + deleted_) / capacity_ >= maxLoadFactor_)
     {
-      rehash(capacity_ * 2);
+      rehash(loadFactor() * 2 >= maxLoadFactor_ ? capacity_ * 2 : capacity_);
     }
     std::pair< Key, T > temp(std::forward< Args >(args)...);
     const Key & key = temp.first;
@@ -461,6 +589,10 @@ namespace maslov
     }
     if (hasFind)
     {
+      if (slots_[pos].deleted)
+      {
+        deleted_--;
+      }
       slots_[pos].data = std::move(temp);
       slots_[pos].occupied = true;
       slots_[pos].deleted = false;
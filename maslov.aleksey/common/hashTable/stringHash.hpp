@@ -0,0 +1,67 @@
+#ifndef STRING_HASH_HPP
+#define STRING_HASH_HPP
+
+#include <cstring>
+#include <boost/hash2/xxhash.hpp>
+
+namespace maslov::detail
+{
+  inline const char * charData(const char * str) noexcept
+  {
+    return str;
+  }
+
+  inline size_t charSize(const char * str) noexcept
+  {
+    return std::strlen(str);
+  }
+
+  template< class Str >
+  auto charData(const Str & str) noexcept -> decltype(str.data())
+  {
+    return str.data();
+  }
+
+  template< class Str >
+  auto charSize(const Str & str) noexcept -> decltype(str.size())
+  {
+    return str.size();
+  }
+
+  struct StringHash1
+  {
+    using is_transparent = void;
+    template< class Str >
+    size_t operator()(const Str & str) const
+    {
+      boost::hash2::xxhash_64 hasher(1);
+      hasher.update(charData(str), charSize(str));
+      return hasher.result();
+    }
+  };
+
+  struct StringHash2
+  {
+    using is_transparent = void;
+    template< class Str >
+    size_t operator()(const Str & str) const
+    {
+      boost::hash2::xxhash_64 hasher(2);
+      hasher.update(charData(str), charSize(str));
+      return hasher.result();
+    }
+  };
+
+  struct StringEqual
+  {
+    using is_transparent = void;
+    template< class Lhs, class Rhs >
+    bool operator()(const Lhs & lhs, const Rhs & rhs) const
+    {
+      size_t size = charSize(lhs);
+      return size == charSize(rhs) && std::memcmp(charData(lhs), charData(rhs), size) == 0;
+    }
+  };
+}
+
+#endif
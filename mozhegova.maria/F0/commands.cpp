@@ -1,8 +1,10 @@
 #include "commands.hpp"
 #include <fstream>
 #include <string>
+#include <memory>
 #include <numeric>
 #include <iomanip>
+#include <algorithm>
 
 namespace
 {
@@ -33,71 +35,35 @@ namespace
     }
   };
 
-  void bubbleSort(mozhegova::DynamicArray< std::pair< mozhegova::WordPos, std::string > > & arr)
+  struct JoinLines
   {
-    size_t n = arr.size();
-    for (size_t i = 0; i < n - 1; i++)
+    std::string & result;
+    void operator()(const mozhegova::Text::Line & line) const
     {
-      bool swapped = false;
-      for (size_t j = 0; j < n - i - 1; j++)
+      if (line.empty())
       {
-        if (arr[j].first > arr[j + 1].first)
-        {
-          std::pair< mozhegova::WordPos, std::string > temp = arr[j];
-          arr[j] = arr[j + 1];
-          arr[j + 1] = temp;
-          swapped = true;
-        }
+        return;
       }
-      if (swapped == false)
+      if (!result.empty())
       {
-        break;
+        result += '\n';
       }
-    }
-  }
-
-  std::string reconstructText(const mozhegova::Text & text)
-  {
-    mozhegova::DynamicArray< std::pair< mozhegova::WordPos, std::string > > sortedWords;
-    for (auto it1 = text.cbegin(); it1 != text.cend(); ++it1)
-    {
-      for (size_t i = 0; i < it1->second.size(); ++i)
-      {
-        sortedWords.push_back({it1->second[i], it1->first});
-      }
-    }
-    bubbleSort(sortedWords);
-    if (sortedWords.empty())
-    {
-      return "";
-    }
-    std::string result;
-    for (size_t i = 0; i < sortedWords.size(); ++i)
-    {
-      result += sortedWords[i].second;
-      if (i < sortedWords.size() - 1)
+      for (size_t i = 0; i < line.size(); ++i)
       {
-        if (sortedWords[i].first.first != sortedWords[i + 1].first.first)
-        {
-          result += '\n';
-        }
-        else
+        if (i != 0)
         {
           result += ' ';
         }
+        result += line[i];
       }
     }
-    return result;
-  }
+  };
 
-  size_t getCountWords(const mozhegova::Text & text)
+  std::string reconstructText(const mozhegova::Text & text)
   {
-    size_t count = 0;
-    for (auto it1 = text.cbegin(); it1 != text.cend(); ++it1)
-    {
-      count += it1->second.size();
-    }
-    return count;
+    std::string result;
+    text.traverseLines(JoinLines{result});
+    return result;
   }
 
   struct PrintText
@@ -106,139 +72,37 @@ namespace
     void operator()(const std::pair< std::string, mozhegova::Text > & text) const
     {
       out << text.first << ' ';
-      out << getCountWords(text.second) << '\n';
+      out << text.second.getWordsCount() << '\n';
       out << reconstructText(text.second) << '\n';
     }
   };
 
-  size_t getMaxLineNumWord(constWord & word)
-  {
-    mozhegova::Xrefs xrefs = word.second;
-    if (xrefs.empty())
-    {
-      return 0;
-    }
-    size_t maxNumWord = 1;
-    for (size_t i = 0; i < word.second.size(); ++i)
-    {
-      if (maxNumWord < word.second[i].first)
-      {
-        maxNumWord = word.second[i].first;
-      }
-    }
-    return maxNumWord;
-  }
-
-  size_t getMaxLineNum(const mozhegova::Text & text)
-  {
-    size_t maxLineNum = 1;
-    for (auto it1 = text.cbegin(); it1 != text.cend(); ++it1)
-    {
-      if (maxLineNum < getMaxLineNumWord(*it1))
-      {
-        maxLineNum = getMaxLineNumWord(*it1);
-      }
-    }
-    return maxLineNum;
-  }
-
-  size_t getMaxNumWord(constWord & word)
-  {
-    mozhegova::Xrefs xrefs = word.second;
-    if (xrefs.empty())
-    {
-      return 0;
-    }
-    size_t maxNumWord = 1;
-    for (size_t i = 0; i < word.second.size(); ++i)
-    {
-      if (maxNumWord < word.second[i].second)
-      {
-        maxNumWord = word.second[i].second;
-      }
-    }
-    return maxNumWord;
-  }
-
-  size_t getMaxNum(const mozhegova::Text & text)
-  {
-    size_t maxLineNum = 1;
-    for (auto it1 = text.cbegin(); it1 != text.cend(); ++it1)
-    {
-      if (maxLineNum < getMaxNumWord(*it1))
-      {
-        maxLineNum = getMaxNumWord(*it1);
-      }
-    }
-    return maxLineNum;
-  }
-
-  mozhegova::Text extractSubstring(const mozhegova::Text & text, size_t begin, size_t end)
-  {
-    mozhegova::Text result;
-    for (auto it1 = text.cbegin(); it1 != text.cend(); ++it1)
-    {
-      mozhegova::Xrefs newXrefs;
-      for (size_t i = 0; i < it1->second.size(); ++i)
-      {
-        if (it1->second[i].first >= begin && it1->second[i].first < end)
-        {
-          newXrefs.push_back(it1->second[i]);
-        }
-      }
-      if (!newXrefs.empty())
-      {
-        result[it1->first] = newXrefs;
-      }
-    }
-    return result;
-  }
-
-  void insertTextTo(mozhegova::Text & text1, const mozhegova::Text & text2, size_t n, size_t begin, size_t end)
+  struct CollectLines
   {
-    mozhegova::Text temp = extractSubstring(text2, begin, end);
-    for (auto it1 = text1.begin(); it1 != text1.end(); ++it1)
-    {
-      for (size_t i = 0; i < it1->second.size(); ++i)
-      {
-        if (it1->second[i].first >= n)
-        {
-          it1->second[i].first += (end - begin);
-        }
-      }
-    }
-    for (auto it2 = temp.cbegin(); it2 != temp.cend(); ++it2)
+    mozhegova::DynamicArray< const mozhegova::Text::Line * > & lines;
+    void operator()(const mozhegova::Text::Line & line) const
     {
-      for (size_t i = 0; i < it2->second.size(); ++i)
-      {
-        text1[it2->first].push_back({it2->second[i].first + n - begin, it2->second[i].second});
-      }
+      lines.push_back(std::addressof(line));
     }
-  }
+  };
 
-  void removeSubstring(mozhegova::Text & text, size_t begin, size_t end)
+  mozhegova::Text readText(std::istream & in, size_t wordCount)
   {
-    for (auto it1 = text.begin(); it1 != text.end();)
+    mozhegova::Text text;
+    size_t count = 0;
+    while (!in.eof() && count < wordCount)
     {
-      bool isDeleted = false;
-      for (size_t i = 0; i < it1->second.size(); ++i)
+      mozhegova::Text::Line line;
+      std::string word;
+      while (in.peek() != '\n' && in >> word)
       {
-        if (it1->second[i].first >= begin && it1->second[i].first < end)
-        {
-          it1 = text.erase(it1);
-          isDeleted = true;
-          break;
-        }
-        else if (it1->second[i].first >= end)
-        {
-          it1->second[i].first -= (end - begin);
-        }
-      }
-      if (!isDeleted)
-      {
-        ++it1;
+        line.push_back(word);
+        ++count;
       }
+      in.ignore();
+      text.pushLine(std::move(line));
     }
+    return text;
   }
 }
 
@@ -256,18 +120,16 @@ void mozhegova::generateLinks(std::istream & in, Texts & texts)
     throw std::runtime_error("<INVALID COMMAND>");
   }
   Text text{};
-  size_t line = 0;
   while (!file.eof())
   {
-    ++line;
+    Text::Line line;
     std::string word;
-    size_t num = 0;
     while (file.peek() != '\n' && file >> word)
     {
-      ++num;
-      text[word].push_back({line, num});
+      line.push_back(word);
     }
     file.ignore();
+    text.pushLine(std::move(line));
   }
   texts[textName] = std::move(text);
 }
@@ -292,17 +154,17 @@ void mozhegova::printLinks(std::istream & in, std::ostream & out, const Texts &
   {
     throw std::runtime_error("<INVALID COMMAND>");
   }
-  const Text & text = it->second;
-  auto maxWordIt = text.cbegin();
+  const Links & links = it->second.getLinks();
+  auto maxWordIt = links.cbegin();
   size_t maxWordLen = maxWordIt->first.size();
-  for (; maxWordIt != text.cend(); ++maxWordIt)
+  for (; maxWordIt != links.cend(); ++maxWordIt)
   {
     if (maxWordLen < maxWordIt->first.size())
     {
       maxWordLen = maxWordIt->first.size();
     }
   }
-  for (auto it2 = text.cbegin(); it2 != text.cend(); ++it2)
+  for (auto it2 = links.cbegin(); it2 != links.cend(); ++it2)
   {
     PrintWords{out, maxWordLen + 2}(*it2);
   }
@@ -348,8 +210,8 @@ void mozhegova::mergeTexts(std::istream & in, Texts & texts)
   const Text & text1 = it1->second;
   const Text & text2 = it2->second;
   Text temp = text1;
-  size_t num = getMaxLineNum(temp) + 1;
-  insertTextTo(temp, text2, num, 1, getMaxLineNum(text2) + 1);
+  size_t num = temp.getMaxLineNum() + 1;
+  temp.insertLines(num, text2, 1, text2.getMaxLineNum() + 1);
   texts[newText] = std::move(temp);
 }
 
@@ -366,11 +228,11 @@ void mozhegova::insertText(std::istream & in, Texts & texts)
   }
   Text & text1 = it1->second;
   const Text & text2 = it2->second;
-  if ((num > 1 + getMaxLineNum(text1)) || (begin < 1) || (end > getMaxLineNum(text2) + 1))
+  if ((num > 1 + text1.getMaxLineNum()) || (begin < 1) || (begin > end) || (end > text2.getMaxLineNum() + 1))
   {
     throw std::runtime_error("<INVALID COMMAND>");
   }
-  insertTextTo(text1, text2, num, begin, end);
+  text1.insertLines(std::max< size_t >(num, 1), text2, begin, end);
 }
 
 void mozhegova::removeLines(std::istream & in, Texts & texts)
@@ -384,11 +246,11 @@ void mozhegova::removeLines(std::istream & in, Texts & texts)
     throw std::runtime_error("<INVALID COMMAND>");
   }
   Text & text = it->second;
-  if ((begin < 1) || (end > getMaxLineNum(text) + 1))
+  if ((begin < 1) || (begin > end) || (end > text.getMaxLineNum() + 1))
   {
     throw std::runtime_error("<INVALID COMMAND>");
   }
-  removeSubstring(text, begin, end);
+  text.removeLines(begin, end);
 }
 
 void mozhegova::moveText(std::istream & in, Texts & texts)
@@ -404,12 +266,12 @@ void mozhegova::moveText(std::istream & in, Texts & texts)
   }
   Text & text1 = it1->second;
   Text & text2 = it2->second;
-  if ((num > 1 + getMaxLineNum(text1)) || (begin < 1) || (end > getMaxLineNum(text2) + 1))
+  if ((num > 1 + text1.getMaxLineNum()) || (begin < 1) || (begin > end) || (end > text2.getMaxLineNum() + 1))
   {
     throw std::runtime_error("<INVALID COMMAND>");
   }
-  insertTextTo(text1, text2, num, begin, end);
-  removeSubstring(text2, begin, end);
+  text1.insertLines(std::max< size_t >(num, 1), text2, begin, end);
+  text2.removeLines(begin, end);
 }
 
 void mozhegova::sideMergeTexts(std::istream & in, Texts & texts)
@@ -423,27 +285,29 @@ void mozhegova::sideMergeTexts(std::istream & in, Texts & texts)
   {
     throw std::runtime_error("<INVALID COMMAND>");
   }
-  const Text & text1 = it1->second;
-  const Text & text2 = it2->second;
-  Text temp1 = text1;
-  Text temp2 = text2;
-  size_t maxLines = std::max(getMaxLineNum(text1), getMaxLineNum(text2));
-  size_t maxNum = getMaxNum(text1);
-  for (size_t line = 1; line <= maxLines; ++line)
+  DynamicArray< const Text::Line * > lines1;
+  DynamicArray< const Text::Line * > lines2;
+  it1->second.traverseLines(CollectLines{lines1});
+  it2->second.traverseLines(CollectLines{lines2});
+  size_t maxLines = std::max(it1->second.getMaxLineNum(), it2->second.getMaxLineNum());
+  Text temp;
+  for (size_t line = 0; line < maxLines; ++line)
   {
-    for (auto it1 = temp2.begin(); it1 != temp2.end(); ++it1)
+    Text::Line merged;
+    if (line < lines1.size())
+    {
+      merged = *lines1[line];
+    }
+    if (line < lines2.size())
     {
-      for (size_t i = 0; i < it1->second.size(); ++i)
+      for (size_t i = 0; i < lines2[line]->size(); ++i)
       {
-        if (it1->second[i].first == line)
-        {
-          it1->second[i].second += maxNum;
-          temp1[it1->first].push_back(it1->second[i]);
-        }
+        merged.push_back((*lines2[line])[i]);
       }
     }
+    temp.pushLine(std::move(merged));
   }
-  texts[newText] = std::move(temp1);
+  texts[newText] = std::move(temp);
 }
 
 void mozhegova::splitTexts(std::istream & in, Texts & texts)
@@ -456,17 +320,15 @@ void mozhegova::splitTexts(std::istream & in, Texts & texts)
   {
     throw std::runtime_error("<INVALID COMMAND>");
   }
-  Text & text = it->second;
-  size_t end = getMaxLineNum(text);
-  if (num > end)
+  if (num > it->second.getMaxLineNum())
   {
     throw std::runtime_error("<INVALID COMMAND>");
   }
-  Text newText = extractSubstring(text, num, end + 1);
-  removeSubstring(text, num, end + 1);
+  Text text = std::move(it->second);
+  Text newText = text.splitLines(std::max< size_t >(num, 1));
+  texts.erase(textName);
   texts[newText1] = std::move(text);
   texts[newText2] = std::move(newText);
-  texts.erase(textName);
 }
 
 void mozhegova::invertLines(std::istream & in, Texts & texts)
@@ -478,15 +340,7 @@ void mozhegova::invertLines(std::istream & in, Texts & texts)
   {
     throw std::runtime_error("<INVALID COMMAND>");
   }
-  Text & text = it->second;
-  size_t maxLine = getMaxLineNum(text);
-  for (auto it1 = text.begin(); it1 != text.end(); ++it1)
-  {
-    for (size_t i = 0; i < it1->second.size(); ++i)
-    {
-      it1->second[i].first = maxLine - it1->second[i].first + 1;
-    }
-  }
+  it->second.invertLines();
 }
 
 void mozhegova::invertWords(std::istream & in, Texts & texts)
@@ -498,22 +352,7 @@ void mozhegova::invertWords(std::istream & in, Texts & texts)
   {
     throw std::runtime_error("<INVALID COMMAND>");
   }
-  Text & text = it->second;
-  size_t maxLines = getMaxLineNum(text);
-  size_t maxNum = getMaxNum(text);
-  for (size_t line = 1; line <= maxLines; ++line)
-  {
-    for (auto it1 = text.begin(); it1 != text.end(); ++it1)
-    {
-      for (size_t i = 0; i < it1->second.size(); ++i)
-      {
-        if (it1->second[i].first == line)
-        {
-          it1->second[i].second = maxNum - it1->second[i].second + 1;
-        }
-      }
-    }
-  }
+  it->second.invertWords();
 }
 
 void mozhegova::replaceWord(std::istream & in, Texts & texts)
@@ -525,14 +364,10 @@ void mozhegova::replaceWord(std::istream & in, Texts & texts)
   {
     throw std::runtime_error("<INVALID COMMAND>");
   }
-  Text & text = it->second;
-  auto wordIt = text.find(oldWord);
-  if (wordIt == text.end())
+  if (!it->second.replaceWord(oldWord, newWord))
   {
     throw std::runtime_error("<INVALID COMMAND>");
   }
-  text[newWord] = std::move(wordIt->second);
-  text.erase(oldWord);
 }
 
 void mozhegova::save(std::istream & in, const Texts & texts)
@@ -572,22 +407,7 @@ void mozhegova::loadFile(const std::string & fileName, Texts & texts)
     std::string textName;
     size_t wordCount;
     file >> textName >> wordCount;
-    Text & currText = texts[textName];
-    std::string word;
-    size_t line = 0;
-    size_t j = 0;
-    while (j < wordCount)
-    {
-      ++line;
-      size_t num = 0;
-      while (file.peek() != '\n' && file >> word)
-      {
-        ++num;
-        currText[word].push_back({line, num});
-        ++j;
-      }
-      file.ignore();
-    }
+    texts[textName] = readText(file, wordCount);
   }
 }
 
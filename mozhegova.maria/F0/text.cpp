@@ -0,0 +1,328 @@
+#include "text.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace mozhegova
+{
+  Text::Text():
+    buffer_(),
+    pieces_(),
+    lines_(0),
+    words_(0),
+    links_(),
+    indexed_(false)
+  {}
+
+  void Text::pushLine(Line && line)
+  {
+    words_ += line.size();
+    buffer_.push_back(std::move(line));
+    ++lines_;
+    if (!pieces_.empty())
+    {
+      Piece & last = pieces_[pieces_.size() - 1];
+      if (!last.reversed && last.begin + last.count + 1 == buffer_.size())
+      {
+        ++last.count;
+        invalidate();
+        return;
+      }
+    }
+    appendPiece(buffer_.size() - 1, 1);
+    invalidate();
+  }
+
+  size_t Text::getLinesCount() const noexcept
+  {
+    return lines_;
+  }
+
+  size_t Text::getWordsCount() const noexcept
+  {
+    return words_;
+  }
+
+  size_t Text::getMaxLineNum() const
+  {
+    size_t line = lines_;
+    for (size_t i = pieces_.size(); i > 0; --i)
+    {
+      for (size_t j = pieces_[i - 1].count; j > 0; --j, --line)
+      {
+        if (!buffer_[getIndex(pieces_[i - 1], j - 1)].empty())
+        {
+          return line;
+        }
+      }
+    }
+    return 1;
+  }
+
+  void Text::insertLines(size_t num, const Text & other, size_t begin, size_t end)
+  {
+    if (begin >= end)
+    {
+      return;
+    }
+    DynamicArray< Line > inserted;
+    size_t pos = 0;
+    for (size_t i = 0; i < other.pieces_.size() && pos + 1 < end; ++i)
+    {
+      const Piece & piece = other.pieces_[i];
+      if (pos + piece.count < begin)
+      {
+        pos += piece.count;
+        continue;
+      }
+      for (size_t j = 0; j < piece.count && pos + 1 < end; ++j, ++pos)
+      {
+        if (pos + 1 >= begin)
+        {
+          inserted.push_back(other.buffer_[getIndex(piece, j)]);
+        }
+      }
+    }
+    while (inserted.size() < end - begin)
+    {
+      inserted.push_back(Line());
+    }
+
+    while (lines_ + 1 < num)
+    {
+      pushLine(Line());
+    }
+    size_t first = buffer_.size();
+    for (size_t i = 0; i < inserted.size(); ++i)
+    {
+      words_ += inserted[i].size();
+      buffer_.push_back(std::move(inserted[i]));
+    }
+    size_t at = splitAt(num - 1);
+    DynamicArray< Piece > pieces;
+    for (size_t i = 0; i < at; ++i)
+    {
+      pieces.push_back(pieces_[i]);
+    }
+    pieces.push_back({first, inserted.size(), false});
+    for (size_t i = at; i < pieces_.size(); ++i)
+    {
+      pieces.push_back(pieces_[i]);
+    }
+    pieces_ = std::move(pieces);
+    lines_ += inserted.size();
+    invalidate();
+  }
+
+  void Text::removeLines(size_t begin, size_t end)
+  {
+    end = std::min(end, lines_ + 1);
+    if (begin >= end)
+    {
+      return;
+    }
+    size_t from = splitAt(begin - 1);
+    size_t to = splitAt(end - 1);
+    DynamicArray< Piece > pieces;
+    for (size_t i = 0; i < pieces_.size(); ++i)
+    {
+      if (i < from || i >= to)
+      {
+        pieces.push_back(pieces_[i]);
+        continue;
+      }
+      for (size_t j = 0; j < pieces_[i].count; ++j)
+      {
+        words_ -= buffer_[getIndex(pieces_[i], j)].size();
+      }
+    }
+    pieces_ = std::move(pieces);
+    lines_ -= end - begin;
+    compact();
+    invalidate();
+  }
+
+  Text Text::splitLines(size_t num)
+  {
+    Text result;
+    if (num > lines_)
+    {
+      return result;
+    }
+    size_t from = splitAt(num - 1);
+    DynamicArray< Piece > pieces;
+    for (size_t i = 0; i < pieces_.size(); ++i)
+    {
+      if (i < from)
+      {
+        pieces.push_back(pieces_[i]);
+        continue;
+      }
+      for (size_t j = 0; j < pieces_[i].count; ++j)
+      {
+        result.pushLine(std::move(buffer_[getIndex(pieces_[i], j)]));
+      }
+    }
+    pieces_ = std::move(pieces);
+    lines_ -= result.lines_;
+    words_ -= result.words_;
+    compact();
+    invalidate();
+    return result;
+  }
+
+  void Text::invertLines()
+  {
+    size_t maxLine = getMaxLineNum();
+    if (maxLine < lines_)
+    {
+      removeLines(maxLine + 1, lines_ + 1);
+    }
+    DynamicArray< Piece > pieces;
+    for (size_t i = pieces_.size(); i > 0; --i)
+    {
+      Piece piece = pieces_[i - 1];
+      piece.reversed = !piece.reversed;
+      pieces.push_back(piece);
+    }
+    pieces_ = std::move(pieces);
+    invalidate();
+  }
+
+  void Text::invertWords()
+  {
+    for (size_t i = 0; i < pieces_.size(); ++i)
+    {
+      for (size_t j = 0; j < pieces_[i].count; ++j)
+      {
+        Line & line = buffer_[getIndex(pieces_[i], j)];
+        for (size_t k = 0; k < line.size() / 2; ++k)
+        {
+          std::swap(line[k], line[line.size() - k - 1]);
+        }
+      }
+    }
+    invalidate();
+  }
+
+  bool Text::replaceWord(const std::string & oldWord, const std::string & newWord)
+  {
+    bool replaced = false;
+    for (size_t i = 0; i < pieces_.size(); ++i)
+    {
+      for (size_t j = 0; j < pieces_[i].count; ++j)
+      {
+        Line & line = buffer_[getIndex(pieces_[i], j)];
+        for (size_t k = 0; k < line.size(); ++k)
+        {
+          if (line[k] == oldWord)
+          {
+            line[k] = newWord;
+            replaced = true;
+          }
+        }
+      }
+    }
+    if (replaced)
+    {
+      invalidate();
+    }
+    return replaced;
+  }
+
+  const Links & Text::getLinks() const
+  {
+    if (!indexed_)
+    {
+      Links links;
+      size_t num = 0;
+      traverseLines([&links, &num](const Line & line)
+      {
+        ++num;
+        for (size_t i = 0; i < line.size(); ++i)
+        {
+          links[line[i]].push_back({num, i + 1});
+        }
+      });
+      links_.swap(links);
+      indexed_ = true;
+    }
+    return links_;
+  }
+
+  size_t Text::getIndex(const Piece & piece, size_t i) noexcept
+  {
+    return piece.reversed ? piece.begin + piece.count - i - 1 : piece.begin + i;
+  }
+
+  size_t Text::splitAt(size_t pos)
+  {
+    size_t i = 0;
+    for (; i < pieces_.size() && pos >= pieces_[i].count; ++i)
+    {
+      pos -= pieces_[i].count;
+    }
+    if (pos == 0)
+    {
+      return i;
+    }
+    Piece head = pieces_[i];
+    Piece tail = pieces_[i];
+    head.count = pos;
+    tail.count -= pos;
+    if (head.reversed)
+    {
+      head.begin += tail.count;
+    }
+    else
+    {
+      tail.begin += pos;
+    }
+    DynamicArray< Piece > pieces;
+    for (size_t j = 0; j < pieces_.size(); ++j)
+    {
+      if (j == i)
+      {
+        pieces.push_back(head);
+        pieces.push_back(tail);
+      }
+      else
+      {
+        pieces.push_back(pieces_[j]);
+      }
+    }
+    pieces_ = std::move(pieces);
+    return i + 1;
+  }
+
+  void Text::appendPiece(size_t begin, size_t count)
+  {
+    if (count != 0)
+    {
+      pieces_.push_back({begin, count, false});
+    }
+  }
+
+  void Text::compact()
+  {
+    if (buffer_.size() <= 2 * lines_ + 32)
+    {
+      return;
+    }
+    DynamicArray< Line > buffer;
+    for (size_t i = 0; i < pieces_.size(); ++i)
+    {
+      for (size_t j = 0; j < pieces_[i].count; ++j)
+      {
+        buffer.push_back(std::move(buffer_[getIndex(pieces_[i], j)]));
+      }
+    }
+    buffer_ = std::move(buffer);
+    pieces_ = DynamicArray< Piece >();
+    appendPiece(0, lines_);
+  }
+
+  void Text::invalidate() noexcept
+  {
+    indexed_ = false;
+  }
+}
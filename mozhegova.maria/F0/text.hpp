@@ -0,0 +1,68 @@
+#ifndef TEXT_HPP
+#define TEXT_HPP
+
+#include <string>
+#include <hashTable.hpp>
+#include <dynamicArray.hpp>
+
+namespace mozhegova
+{
+  using WordPos = std::pair< size_t, size_t >;
+  using Xrefs = DynamicArray< WordPos >;
+  using Links = HashTable< std::string, Xrefs >;
+
+  class Text
+  {
+  public:
+    using Line = DynamicArray< std::string >;
+
+    Text();
+    void pushLine(Line && line);
+    size_t getLinesCount() const noexcept;
+    size_t getWordsCount() const noexcept;
+    size_t getMaxLineNum() const;
+    void insertLines(size_t num, const Text & other, size_t begin, size_t end);
+    void removeLines(size_t begin, size_t end);
+    Text splitLines(size_t num);
+    void invertLines();
+    void invertWords();
+    bool replaceWord(const std::string & oldWord, const std::string & newWord);
+    const Links & getLinks() const;
+    template< class F >
+    F traverseLines(F f) const;
+  private:
+    struct Piece
+    {
+      size_t begin;
+      size_t count;
+      bool reversed;
+    };
+    DynamicArray< Line > buffer_;
+    DynamicArray< Piece > pieces_;
+    size_t lines_;
+    size_t words_;
+    mutable Links links_;
+    mutable bool indexed_;
+
+    static size_t getIndex(const Piece & piece, size_t i) noexcept;
+    size_t splitAt(size_t pos);
+    void appendPiece(size_t begin, size_t count);
+    void compact();
+    void invalidate() noexcept;
+  };
+
+  template< class F >
+  F Text::traverseLines(F f) const
+  {
+    for (size_t i = 0; i < pieces_.size(); ++i)
+    {
+      for (size_t j = 0; j < pieces_[i].count; ++j)
+      {
+        f(buffer_[getIndex(pieces_[i], j)]);
+      }
+    }
+    return f;
+  }
+}
+
+#endif
@@ -22,6 +22,7 @@ namespace mozhegova
     size_t size() const noexcept;
     void swap(DynamicArray & other) noexcept;
     void push_back(const T & value);
+    void push_back(T && value);
   private:
     size_t capacity_;
     size_t size_;
@@ -142,6 +143,16 @@ namespace mozhegova
     }
     data_[size_++] = value;
   }
+
+  template< typename T >
+  void DynamicArray< T >::push_back(T && value)
+  {
+    if (size_ == capacity_)
+    {
+      data_ = resize(data_, capacity_);
+    }
+    data_[size_++] = std::move(value);
+  }
 }
 
 #endif
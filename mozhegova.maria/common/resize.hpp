@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <stdexcept>
+#include <utility>
 
 namespace mozhegova
 {
@@ -10,13 +11,13 @@ namespace mozhegova
   T * resize(T * data, size_t & capacity)
   {
     {
-      size_t size = capacity * 2;
+      size_t size = capacity ? capacity * 2 : 10;
       T * temp = new T[size];
       try
       {
         for (size_t i = 0; i < capacity; i++)
         {
-          temp[i] = data[i];
+          temp[i] = std::move(data[i]);
         }
       }
       catch (...)
@@ -24,7 +25,7 @@ namespace mozhegova
         delete[] temp;
         throw;
       }
-      capacity *= 2;
+      capacity = size;
       delete[] data;
       return temp;
     }
@@ -80,6 +80,23 @@ const rychkov::Set< std::vector< rychkov::Operator >, rychkov::NameCompare > ryc
       {{Operator::BINARY, Operator::ASSIGN, "=", true, true, true, 14}}
     };
 
+const std::string rychkov::Lexer::operator_symbols_ = rychkov::Lexer::collect_operator_symbols();
+
+std::string rychkov::Lexer::collect_operator_symbols()
+{
+  std::string result;
+  for (const std::vector< Operator >& i: cases)
+  {
+    for (char c: i[0].token)
+    {
+      if (result.find(c) == std::string::npos)
+      {
+        result += c;
+      }
+    }
+  }
+  return result;
+}
 void rychkov::Lexer::append_name(CParseContext& context, std::string name)
 {
   flush(context);
@@ -221,6 +238,10 @@ void rychkov::Lexer::append_char_literal(CParseContext& context, std::string nam
 }
 void rychkov::Lexer::flush(CParseContext& context)
 {
+  if (holds_alternative< Monostate >(buf_))
+  {
+    return;
+  }
   if (holds_alternative< entities::Literal >(buf_))
   {
     entities::Literal& lit = get< entities::Literal >(buf_);
@@ -264,7 +285,11 @@ void rychkov::Lexer::append(CParseContext& context, char c)
 }
 void rychkov::Lexer::append_new(CParseContext& context, char c)
 {
-  decltype(cases)::const_iterator oper_p = cases.find(std::string{c});
+  decltype(cases)::const_iterator oper_p = cases.end();
+  if (operator_symbols_.find(c) != std::string::npos)
+  {
+    oper_p = cases.find(std::string{c});
+  }
   if (oper_p != cases.end())
   {
     buf_ = &*oper_p;
@@ -282,7 +307,11 @@ void rychkov::Lexer::append_new(CParseContext& context, char c)
 void rychkov::Lexer::append_operator(CParseContext& context, char c)
 {
   operator_value& oper = get< operator_value >(buf_);
-  decltype(cases)::const_iterator oper_p = cases.find((*oper)[0].token + c);
+  decltype(cases)::const_iterator oper_p = cases.cend();
+  if (operator_symbols_.find(c) != std::string::npos)
+  {
+    oper_p = cases.find((*oper)[0].token + c);
+  }
   if (oper_p != cases.cend())
   {
     buf_ = &*oper_p;
@@ -32,12 +32,14 @@ namespace rychkov
 
   private:
     using operator_value = const std::vector< Operator >*;
+    static const std::string operator_symbols_;
 
     Map< std::string, CParser::TypeKeyword > type_keywords_;
     Map< std::string, void(CParser::*)(CParseContext&) > keywords_;
 
     Variant< Monostate, operator_value, entities::Literal > buf_;
 
+    static std::string collect_operator_symbols();
     void append_new(CParseContext& context, char c);
     void append_operator(CParseContext& context, char c);
   };
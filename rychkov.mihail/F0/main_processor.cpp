@@ -110,7 +110,7 @@ bool rychkov::MainProcessor::parse_after(ParserContext& context)
   {
     std::string after;
     context.in >> after;
-    const CParser& src_parser = *parsed_.at(after).preproc.next->next;
+    const CParser& src_parser = *get_cell(after).preproc.next->next;
     if (!context.in || !eol(context.in))
     {
       return false;
@@ -210,15 +210,15 @@ bool rychkov::MainProcessor::unopen_defines(ParserContext& context)
   {
     return false;
   }
-  const ParseCell& cell = parsed_.at(filename);
+  const ParseCell& file = get_cell(filename);
   if (!eol(context.in))
   {
     return false;
   }
-  std::istringstream in(cell.cache);
+  std::istringstream in(file.cache);
   std::stringstream preprocessed;
   Preprocessor preproc{nullptr, include_dirs_};
-  CParseContext parse_context{preprocessed, context.err, cell.base_context.file};
+  CParseContext parse_context{preprocessed, context.err, file.base_context.file};
   preproc.parse(parse_context, in);
   std::string line;
   size_t line_number = 1;
@@ -10,6 +10,7 @@
 
 #include "log.hpp"
 #include "preprocessor.hpp"
+#include "snapshot.hpp"
 
 namespace rychkov
 {
@@ -27,6 +28,7 @@ namespace rychkov
     Preprocessor preproc;
     bool real_file = true;
     std::string cache;
+    SnapshotSlice pending;
   };
 
   class MainProcessor
@@ -60,6 +62,11 @@ namespace rychkov
     bool unopen_defines(ParserContext& context);
 
   private:
+    ParseCell& get_cell(const std::string& filename);
+    void materialize(ParseCell& cell);
+    bool load_snapshot(std::ostream& out, std::ostream& err, const std::string& filename);
+    bool save_snapshot(std::ostream& err, const std::string& filename) const;
+
     Stage last_stage_ = CPARSER;
     std::vector< std::string > include_dirs_;
     Map< std::string, ParseCell > parsed_;
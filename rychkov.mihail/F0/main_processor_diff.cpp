@@ -104,6 +104,10 @@ bool rychkov::MainProcessor::intersections(ParserContext& context)
   {
     return false;
   }
+  for (std::pair< const std::string, ParseCell >& cell: parsed_)
+  {
+    materialize(cell.second);
+  }
   DiffVisitor visitor = for_each(parsed_.begin(), parsed_.end(), DiffVisitor{});
   bool empty = true;
   for (const decltype(visitor.appearances)::value_type& list: visitor.appearances)
@@ -143,6 +147,13 @@ bool rychkov::MainProcessor::diff(ParserContext& context)
     context.in >> name;
     files.insert(name);
   }
+  for (std::pair< const std::string, ParseCell >& cell: parsed_)
+  {
+    if (files.empty() || (files.find(cell.first) != files.end()))
+    {
+      materialize(cell.second);
+    }
+  }
   DiffVisitor visitor = for_each(parsed_.begin(), parsed_.end(), DiffVisitor{std::move(files)});
   bool empty = true;
   using MacroIter = decltype(visitor.macros)::const_iterator;
@@ -34,7 +34,7 @@ bool rychkov::MainProcessor::tree(ParserContext& context)
   {
     return false;
   }
-  const CParser& parser = *parsed_.at(filename).preproc.next->next;
+  const CParser& parser = *get_cell(filename).preproc.next->next;
   if (!eol(context.in))
   {
     return false;
@@ -50,8 +50,9 @@ bool rychkov::MainProcessor::external(ParserContext& context)
   }
   ContentPrinter printer{context.out};
   bool no_external = true;
-  for (const std::pair< const std::string, ParseCell >& cell: parsed_)
+  for (std::pair< const std::string, ParseCell >& cell: parsed_)
   {
+    materialize(cell.second);
     for (const entities::Expression& expr: *cell.second.preproc.next->next)
     {
       if (entities::is_decl(expr))
@@ -78,7 +79,7 @@ bool rychkov::MainProcessor::exposition(ParserContext& context)
   {
     return false;
   }
-  const CParser& parser = *parsed_.at(filename).preproc.next->next;
+  const CParser& parser = *get_cell(filename).preproc.next->next;
   if (!eol(context.in))
   {
     return false;
@@ -112,7 +113,7 @@ bool rychkov::MainProcessor::defines(ParserContext& context)
   {
     return false;
   }
-  const Preprocessor& preproc = parsed_.at(filename).preproc;
+  const Preprocessor& preproc = get_cell(filename).preproc;
   if (!eol(context.in))
   {
     return false;
@@ -4,6 +4,7 @@
 #include <fstream>
 #include <sstream>
 #include <iterator>
+#include <memory>
 #include <utility>
 #include <stdexcept>
 #include <boost/json.hpp>
@@ -37,10 +38,15 @@ namespace rychkov
     entities::CastOperation as_cast(const boost::json::value& val);
     entities::Body as_body(const boost::json::value& val);
   };
+  void load_cell(ParseCell& cell, const boost::json::object& obj);
 }
 
 bool rychkov::MainProcessor::load(std::ostream& out, std::ostream& err, std::string filename)
 {
+  if (is_snapshot_name(filename))
+  {
+    return load_snapshot(out, err, filename);
+  }
   std::ifstream in(filename);
   if (!in)
   {
@@ -56,39 +62,100 @@ bool rychkov::MainProcessor::load(std::ostream& out, std::ostream& err, std::str
           ParseCell{{out, err, file.key()}, last_stage_, include_dirs_});
     if (cell_p.second)
     {
-      Preprocessor& preproc = cell_p.first->second.preproc;
       out << "<--LOAD: \"" << file.key() << "\"-->\n";
-      const boost::json::object& obj = file.value().as_object();
-
-      const boost::json::array& macros = obj.at("macros").as_array();
-      rychkov::transform(macros.begin(), macros.end(),
-            std::inserter(preproc.macros, preproc.macros.end()), Loader::as_macro);
-      const boost::json::array& legacy = obj.at("old_macro").as_array();
-      rychkov::transform(legacy.begin(), legacy.end(),
-            std::inserter(preproc.legacy_macros, preproc.legacy_macros.end()), Loader::as_macro);
-
-      const boost::json::array& pgm = obj.at("pgm").as_array();
-      CParser& parser = *preproc.next->next;
-      parser.prepare_to_rewrite();
-      Loader loader = for_each(pgm.begin(), pgm.end(), Loader{parser});
-      cell_p.first->second.real_file = obj.at("real").as_bool();
+      load_cell(cell_p.first->second, file.value().as_object());
       ngenerated += !cell_p.first->second.real_file;
-      cell_p.first->second.cache = boost::json::value_to< std::string >(obj.at("cache"));
-
-      parser.defined_functions = loader.preproc.next->next->defined_functions;
-      parser.base_types = loader.preproc.next->next->base_types;
-      parser.variables = loader.preproc.next->next->variables;
-      parser.structs = loader.preproc.next->next->structs;
-      parser.unions = loader.preproc.next->next->unions;
-      parser.enums = loader.preproc.next->next->enums;
-      parser.aliases = loader.preproc.next->next->aliases;
-      parser.defined_functions = loader.preproc.next->next->defined_functions;
     }
   }
   parsed_ = std::move(new_parsed);
   generated_files = ngenerated;
   return true;
 }
+bool rychkov::MainProcessor::load_snapshot(std::ostream& out, std::ostream& err, const std::string& filename)
+{
+  std::shared_ptr< const MappedFile > file;
+  std::vector< SnapshotEntry > toc;
+  try
+  {
+    file = std::make_shared< const MappedFile >(filename);
+    toc = read_snapshot(file);
+  }
+  catch (const std::exception& e)
+  {
+    err << e.what() << '\n';
+    return false;
+  }
+  Map< std::string, ParseCell > new_parsed;
+  size_t ngenerated = 0;
+  for (SnapshotEntry& entry: toc)
+  {
+    std::pair< decltype(new_parsed)::iterator, bool > cell_p = new_parsed.emplace(entry.name,
+          ParseCell{{out, err, entry.name}, last_stage_, include_dirs_});
+    if (cell_p.second)
+    {
+      out << "<--LOAD: \"" << entry.name << "\"-->\n";
+      cell_p.first->second.real_file = entry.real_file;
+      cell_p.first->second.pending = std::move(entry.slice);
+      ngenerated += !entry.real_file;
+    }
+  }
+  parsed_ = std::move(new_parsed);
+  generated_files = ngenerated;
+  return true;
+}
+rychkov::ParseCell& rychkov::MainProcessor::get_cell(const std::string& filename)
+{
+  ParseCell& result = parsed_.at(filename);
+  materialize(result);
+  return result;
+}
+void rychkov::MainProcessor::materialize(ParseCell& cell)
+{
+  if (cell.pending.empty())
+  {
+    return;
+  }
+  ParseCell loaded{cell.base_context, last_stage_, include_dirs_};
+  try
+  {
+    boost::json::value doc = boost::json::parse(boost::json::string_view{cell.pending.data(), cell.pending.size});
+    load_cell(loaded, doc.as_object());
+  }
+  catch (const std::exception& e)
+  {
+    cell.base_context.err << "corrupted snapshot section \"" << cell.base_context.file << "\" - " << e.what() << '\n';
+    throw;
+  }
+  cell.preproc = std::move(loaded.preproc);
+  cell.real_file = loaded.real_file;
+  cell.cache = std::move(loaded.cache);
+  cell.pending = {};
+}
+void rychkov::load_cell(ParseCell& cell, const boost::json::object& obj)
+{
+  Preprocessor& preproc = cell.preproc;
+  const boost::json::array& macros = obj.at("macros").as_array();
+  rychkov::transform(macros.begin(), macros.end(),
+        std::inserter(preproc.macros, preproc.macros.end()), Loader::as_macro);
+  const boost::json::array& legacy = obj.at("old_macro").as_array();
+  rychkov::transform(legacy.begin(), legacy.end(),
+        std::inserter(preproc.legacy_macros, preproc.legacy_macros.end()), Loader::as_macro);
+
+  const boost::json::array& pgm = obj.at("pgm").as_array();
+  CParser& parser = *preproc.next->next;
+  parser.prepare_to_rewrite();
+  Loader loader = for_each(pgm.begin(), pgm.end(), Loader{parser});
+  cell.real_file = obj.at("real").as_bool();
+  cell.cache = boost::json::value_to< std::string >(obj.at("cache"));
+
+  parser.defined_functions = loader.preproc.next->next->defined_functions;
+  parser.base_types = loader.preproc.next->next->base_types;
+  parser.variables = loader.preproc.next->next->variables;
+  parser.structs = loader.preproc.next->next->structs;
+  parser.unions = loader.preproc.next->next->unions;
+  parser.enums = loader.preproc.next->next->enums;
+  parser.aliases = loader.preproc.next->next->aliases;
+}
 rychkov::Macro rychkov::Loader::as_macro(const boost::json::value& val)
 {
   const boost::json::object& obj = val.as_object();
@@ -1,5 +1,6 @@
 #include "main_processor.hpp"
 
+#include <cstdio>
 #include <fstream>
 #include <sstream>
 #include <iterator>
@@ -30,10 +31,15 @@ namespace rychkov
     boost::json::value operator()(const entities::Expression& root);
     boost::json::value operator()(const entities::Expression::operand& operand);
   };
+  boost::json::value serialize_cell(const ParseCell& cell);
 }
 
 bool rychkov::MainProcessor::save(std::ostream& err, std::string filename) const
 {
+  if (is_snapshot_name(filename))
+  {
+    return save_snapshot(err, filename);
+  }
   std::ofstream out(filename);
   if (!out)
   {
@@ -43,22 +49,59 @@ bool rychkov::MainProcessor::save(std::ostream& err, std::string filename) const
   boost::json::object doc;
   for (const std::pair< const std::string, ParseCell >& file: parsed_)
   {
-    const Preprocessor& preproc = file.second.preproc;
-    const CParser& src = *preproc.next->next;
-    Serializer serial;
-    boost::json::array macros(preproc.macros.size());
-    boost::json::array legacy_macros(preproc.legacy_macros.size());
-    boost::json::array program;
-    rychkov::transform(preproc.macros.begin(), preproc.macros.end(), macros.begin(), serial);
-    rychkov::transform(preproc.legacy_macros.begin(), preproc.legacy_macros.end(), legacy_macros.begin(), serial);
-    rychkov::transform(src.begin(), src.end(), std::back_inserter(program), serial);
-    doc[file.first] = boost::json::object{{"macros", std::move(macros)},
-          {"old_macro", std::move(legacy_macros)}, {"pgm", std::move(program)},
-          {"real", file.second.real_file}, {"cache", file.second.cache}};
+    const SnapshotSlice& slice = file.second.pending;
+    doc[file.first] = slice.empty() ? serialize_cell(file.second)
+          : boost::json::parse(boost::json::string_view{slice.data(), slice.size});
   }
   out << doc << '\n';
   return out.good();
 }
+bool rychkov::MainProcessor::save_snapshot(std::ostream& err, const std::string& filename) const
+{
+  std::string temp_name = filename + ".tmp";
+  std::ofstream out(temp_name, std::ios::binary);
+  if (!out)
+  {
+    err << "failed to open save file on write - \"" << filename << "\"\n";
+    return false;
+  }
+  SnapshotWriter writer{out};
+  for (const std::pair< const std::string, ParseCell >& file: parsed_)
+  {
+    const SnapshotSlice& slice = file.second.pending;
+    if (!slice.empty())
+    {
+      writer.add(file.first, file.second.real_file, slice.data(), slice.size);
+      continue;
+    }
+    std::string data = boost::json::serialize(serialize_cell(file.second));
+    writer.add(file.first, file.second.real_file, data.data(), data.size());
+  }
+  bool written = writer.finish();
+  out.close();
+  if (!written || !out || (std::rename(temp_name.c_str(), filename.c_str()) != 0))
+  {
+    std::remove(temp_name.c_str());
+    err << "failed to write save file - \"" << filename << "\"\n";
+    return false;
+  }
+  return true;
+}
+boost::json::value rychkov::serialize_cell(const ParseCell& cell)
+{
+  const Preprocessor& preproc = cell.preproc;
+  const CParser& src = *preproc.next->next;
+  Serializer serial;
+  boost::json::array macros(preproc.macros.size());
+  boost::json::array legacy_macros(preproc.legacy_macros.size());
+  boost::json::array program;
+  rychkov::transform(preproc.macros.begin(), preproc.macros.end(), macros.begin(), serial);
+  rychkov::transform(preproc.legacy_macros.begin(), preproc.legacy_macros.end(), legacy_macros.begin(), serial);
+  rychkov::transform(src.begin(), src.end(), std::back_inserter(program), serial);
+  return boost::json::object{{"macros", std::move(macros)},
+        {"old_macro", std::move(legacy_macros)}, {"pgm", std::move(program)},
+        {"real", cell.real_file}, {"cache", cell.cache}};
+}
 
 std::string rychkov::Serializer::operator()(const typing::Type& type)
 {
@@ -124,26 +124,23 @@ void rychkov::Preprocessor::flush_buf(CParseContext& context)
       {
         if (next == nullptr)
         {
-          for (char c: buf_)
-          {
-            flush(context, c);
-          }
+          context.out << buf_;
         }
         else
         {
           switch (prev)
           {
           case rychkov::Preprocessor::STRING_LITERAL:
-            next->append_string_literal(context, buf_);
+            next->append_string_literal(context, std::move(buf_));
             break;
           case rychkov::Preprocessor::CHAR_LITERAL:
-            next->append_char_literal(context, buf_);
+            next->append_char_literal(context, std::move(buf_));
             break;
           case rychkov::Preprocessor::NAME:
-            next->append_name(context, buf_);
+            next->append_name(context, std::move(buf_));
             break;
           case rychkov::Preprocessor::NUMBER:
-            next->append_number(context, buf_);
+            next->append_number(context, std::move(buf_));
             break;
           default:
             for (char c: buf_)
@@ -185,10 +182,15 @@ void rychkov::Preprocessor::parse(CParseContext& context, std::istream& in, bool
     not_first_line = true;
     context.symbol = 0;
     std::getline(in, context.last_line);
-    for (char c: context.last_line)
+    const std::string& line = context.last_line;
+    while (context.symbol < line.length())
     {
-      append(context, c);
-      context.symbol++;
+      size_t end = scan(context, line, context.symbol);
+      if (end == context.symbol)
+      {
+        append(context, line[end++]);
+      }
+      context.symbol = end;
     }
   }
   if (need_flush)
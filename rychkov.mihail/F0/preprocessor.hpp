@@ -31,6 +31,7 @@ namespace rychkov
     static std::string get_name(std::istream& in);
     void parse(CParseContext& context, std::istream& in, bool need_flush = true);
     void append(CParseContext& context, char c);
+    size_t scan(CParseContext& context, const std::string& line, size_t pos);
     void flush(CParseContext& context);
     void flush(CParseContext& context, char c);
 
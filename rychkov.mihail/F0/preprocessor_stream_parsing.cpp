@@ -1,7 +1,161 @@
 #include "preprocessor.hpp"
 
 #include <iostream>
+#include <cctype>
 #include <utility>
+#include <algorithm.hpp>
+
+namespace rychkov
+{
+  struct IsNameSymbol
+  {
+    bool operator()(unsigned char c) const
+    {
+      return std::isalnum(c) || (c == '_');
+    }
+  };
+  struct IsNumberSymbol
+  {
+    bool operator()(unsigned char c) const
+    {
+      return std::isalnum(c) || (c == '_') || (c == '.') || (c == '\'');
+    }
+  };
+  struct IsSpaceSymbol
+  {
+    bool operator()(unsigned char c) const
+    {
+      return std::isspace(c);
+    }
+  };
+  struct IsTokenStart
+  {
+    bool operator()(unsigned char c) const
+    {
+      return std::isalnum(c) || std::isspace(c) || (c == '_') || (c == '/') || (c == '"') || (c == '\'')
+          || (c == '\\') || (c == '#');
+    }
+  };
+  struct IsPlainSymbol
+  {
+    const char* special;
+    bool operator()(char c) const
+    {
+      for (const char* i = special; *i != '\0'; i++)
+      {
+        if (c == *i)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+  };
+}
+
+size_t rychkov::Preprocessor::scan(CParseContext& context, const std::string& line, size_t pos)
+{
+  if (screened_)
+  {
+    return pos;
+  }
+  const char* from = line.data() + pos;
+  const char* to = line.data() + line.length();
+  const char* end = from;
+  switch (state_)
+  {
+  case SINGLE_LINE_COMMENT:
+    end = find_if_not(from, to, IsPlainSymbol{"\\"});
+    return end - line.data();
+  case MULTI_LINE_COMMENT:
+    for (; (end != to) && (*end != '\\') && ((prev_ != '*') || (*end != '/')); ++end)
+    {
+      prev_ = *end;
+    }
+    return end - line.data();
+  case STRING_LITERAL:
+    end = find_if_not(from, to, IsPlainSymbol{"\"\\"});
+    buf_.append(from, end);
+    return end - line.data();
+  case CHAR_LITERAL:
+    end = find_if_not(from, to, IsPlainSymbol{"'\\"});
+    buf_.append(from, end);
+    return end - line.data();
+  case NAME:
+    end = find_if_not(from, to, IsNameSymbol{});
+    buf_.append(from, end);
+    return end - line.data();
+  case NUMBER:
+    end = find_if_not(from, to, IsNumberSymbol{});
+    buf_.append(from, end);
+    return end - line.data();
+  case DIRECTIVE:
+    if (prev_ == '/')
+    {
+      return pos;
+    }
+    end = find_if_not(from, to, IsPlainSymbol{"/\"'\\#"});
+    if (find_if_not(from, end, IsSpaceSymbol{}) != end)
+    {
+      empty_line_ = false;
+    }
+    buf_.append(from, end);
+    return end - line.data();
+  case NO_STATE:
+    if ((prev_ == '/') || (from == to))
+    {
+      return pos;
+    }
+    if (std::isalpha(*from) || (*from == '_'))
+    {
+      empty_line_ = false;
+      state_ = NAME;
+      return scan(context, line, pos);
+    }
+    if (std::isdigit(*from))
+    {
+      empty_line_ = false;
+      state_ = NUMBER;
+      return scan(context, line, pos);
+    }
+    end = find_if_not(from, to, IsSpaceSymbol{});
+    if ((end != from) && !skip_all())
+    {
+      if (next == nullptr)
+      {
+        context.out.write(from, end - from);
+      }
+      else
+      {
+        next->flush(context);
+      }
+    }
+    if (end != from)
+    {
+      return end - line.data();
+    }
+    end = find_if(from, to, IsTokenStart{});
+    empty_line_ = empty_line_ && (end == from);
+    if ((end != from) && !skip_all())
+    {
+      if (next == nullptr)
+      {
+        context.out.write(from, end - from);
+      }
+      else
+      {
+        for (; from != end; ++from)
+        {
+          context.symbol = from - line.data();
+          next->append(context, *from);
+        }
+      }
+    }
+    return end - line.data();
+  default:
+    return pos;
+  }
+}
 
 void rychkov::Preprocessor::append(CParseContext& context, char c)
 {
@@ -0,0 +1,165 @@
+#include "snapshot.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace rychkov
+{
+  constexpr char snapshot_magic[8] = {'R', 'Y', 'C', 'H', 'S', 'N', 'A', 'P'};
+  constexpr uint64_t snapshot_version = 1;
+  constexpr size_t snapshot_header_size = sizeof(snapshot_magic) + 3 * sizeof(uint64_t);
+  constexpr const char* snapshot_extension = ".snap";
+
+  struct SnapshotReader
+  {
+    const char* data;
+    size_t size;
+    size_t pos;
+
+    uint64_t read_number();
+    std::string read_string();
+  };
+  void write_number(std::ostream& out, uint64_t value);
+}
+
+rychkov::MappedFile::MappedFile(const std::string& filename)
+{
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd == -1)
+  {
+    throw std::runtime_error("failed to open snapshot \"" + filename + '"');
+  }
+  struct stat info;
+  if ((::fstat(fd, &info) == -1) || (info.st_size <= 0))
+  {
+    ::close(fd);
+    throw std::runtime_error("failed to read snapshot \"" + filename + '"');
+  }
+  size_ = info.st_size;
+  data_ = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (data_ == MAP_FAILED)
+  {
+    throw std::runtime_error("failed to map snapshot \"" + filename + '"');
+  }
+}
+rychkov::MappedFile::~MappedFile()
+{
+  ::munmap(data_, size_);
+}
+const char* rychkov::MappedFile::data() const noexcept
+{
+  return static_cast< const char* >(data_);
+}
+size_t rychkov::MappedFile::size() const noexcept
+{
+  return size_;
+}
+
+bool rychkov::SnapshotSlice::empty() const noexcept
+{
+  return file == nullptr;
+}
+const char* rychkov::SnapshotSlice::data() const noexcept
+{
+  return file->data() + offset;
+}
+
+rychkov::SnapshotWriter::SnapshotWriter(std::ostream& out):
+  out_(out)
+{
+  out_.write(snapshot_magic, sizeof(snapshot_magic));
+  write_number(out_, snapshot_version);
+  write_number(out_, 0);
+  write_number(out_, 0);
+}
+void rychkov::SnapshotWriter::add(const std::string& name, bool real_file, const char* data, size_t size)
+{
+  toc_.push_back({name, real_file, {nullptr, static_cast< size_t >(out_.tellp()), size}});
+  out_.write(data, size);
+}
+bool rychkov::SnapshotWriter::finish()
+{
+  uint64_t toc_offset = out_.tellp();
+  for (const SnapshotEntry& entry: toc_)
+  {
+    write_number(out_, entry.name.size());
+    out_.write(entry.name.data(), entry.name.size());
+    write_number(out_, entry.real_file);
+    write_number(out_, entry.slice.offset);
+    write_number(out_, entry.slice.size);
+  }
+  out_.seekp(sizeof(snapshot_magic) + sizeof(uint64_t));
+  write_number(out_, toc_.size());
+  write_number(out_, toc_offset);
+  out_.flush();
+  return out_.good();
+}
+
+bool rychkov::is_snapshot_name(const std::string& filename)
+{
+  size_t ext_size = std::strlen(snapshot_extension);
+  return (filename.size() > ext_size) && (filename.compare(filename.size() - ext_size, ext_size,
+        snapshot_extension) == 0);
+}
+std::vector< rychkov::SnapshotEntry > rychkov::read_snapshot(std::shared_ptr< const MappedFile > file)
+{
+  if ((file->size() < snapshot_header_size)
+        || (std::memcmp(file->data(), snapshot_magic, sizeof(snapshot_magic)) != 0))
+  {
+    throw std::invalid_argument("not a snapshot file");
+  }
+  SnapshotReader reader{file->data(), file->size(), sizeof(snapshot_magic)};
+  if (reader.read_number() != snapshot_version)
+  {
+    throw std::invalid_argument("unsupported snapshot version");
+  }
+  uint64_t nfiles = reader.read_number();
+  reader.pos = reader.read_number();
+  std::vector< SnapshotEntry > result;
+  for (uint64_t i = 0; i < nfiles; i++)
+  {
+    SnapshotEntry entry{reader.read_string(), reader.read_number() != 0, {file, 0, 0}};
+    entry.slice.offset = reader.read_number();
+    entry.slice.size = reader.read_number();
+    if ((entry.slice.offset > file->size()) || (entry.slice.size > file->size() - entry.slice.offset))
+    {
+      throw std::invalid_argument("snapshot section is out of file");
+    }
+    result.push_back(std::move(entry));
+  }
+  return result;
+}
+
+uint64_t rychkov::SnapshotReader::read_number()
+{
+  uint64_t result = 0;
+  if ((pos > size) || (size - pos < sizeof(result)))
+  {
+    throw std::invalid_argument("unexpected end of snapshot");
+  }
+  std::memcpy(&result, data + pos, sizeof(result));
+  pos += sizeof(result);
+  return result;
+}
+std::string rychkov::SnapshotReader::read_string()
+{
+  uint64_t length = read_number();
+  if (length > size - pos)
+  {
+    throw std::invalid_argument("unexpected end of snapshot");
+  }
+  std::string result{data + pos, length};
+  pos += length;
+  return result;
+}
+void rychkov::write_number(std::ostream& out, uint64_t value)
+{
+  out.write(reinterpret_cast< const char* >(&value), sizeof(value));
+}
@@ -0,0 +1,58 @@
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rychkov
+{
+  class MappedFile
+  {
+  public:
+    explicit MappedFile(const std::string& filename);
+    MappedFile(const MappedFile&) = delete;
+    ~MappedFile();
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const noexcept;
+    size_t size() const noexcept;
+  private:
+    void* data_ = nullptr;
+    size_t size_ = 0;
+  };
+
+  struct SnapshotSlice
+  {
+    std::shared_ptr< const MappedFile > file;
+    size_t offset = 0;
+    size_t size = 0;
+
+    bool empty() const noexcept;
+    const char* data() const noexcept;
+  };
+  struct SnapshotEntry
+  {
+    std::string name;
+    bool real_file = true;
+    SnapshotSlice slice;
+  };
+
+  class SnapshotWriter
+  {
+  public:
+    explicit SnapshotWriter(std::ostream& out);
+    void add(const std::string& name, bool real_file, const char* data, size_t size);
+    bool finish();
+  private:
+    std::ostream& out_;
+    std::vector< SnapshotEntry > toc_;
+  };
+
+  bool is_snapshot_name(const std::string& filename);
+  std::vector< SnapshotEntry > read_snapshot(std::shared_ptr< const MappedFile > file);
+}
+
+#endif
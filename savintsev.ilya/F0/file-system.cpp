@@ -1,6 +1,7 @@
 #include "file-system.hpp"
 #include <fstream>
 #include <algorithm>
+#include <utility>
 #include "shape-utils.hpp"
 
 std::string savintsev::get_filename(const std::string & filename)
@@ -109,7 +110,7 @@ void savintsev::read_savi_file(const std::string & filename, Projects & projs)
     file >> figure;
   }
 
-  projs[get_filename(filename)] = project;
+  projs[get_filename(filename)] = std::move(project);
 }
 
 void savintsev::write_savi_file(const std::string & filename, Project & proj)
@@ -0,0 +1,305 @@
+#include "project-body.hpp"
+#include <algorithm>
+#include <memory>
+#include <packed-shape.hpp>
+
+savintsev::Project::Project():
+  layers_(),
+  index_(),
+  geometry_(std::make_shared< GeometryStore >()),
+  loose_(0)
+{}
+
+savintsev::Project::Project(const Project & rhs):
+  layers_(rhs.layers_),
+  index_(),
+  geometry_(rhs.geometry_),
+  loose_(rhs.loose_)
+{
+  rebuild_index();
+}
+
+savintsev::Project & savintsev::Project::operator=(const Project & rhs)
+{
+  if (this != std::addressof(rhs))
+  {
+    Project temp(rhs);
+    *this = std::move(temp);
+  }
+  return *this;
+}
+
+savintsev::Project::iterator savintsev::Project::begin() noexcept
+{
+  return layers_.begin();
+}
+
+savintsev::Project::iterator savintsev::Project::end() noexcept
+{
+  return layers_.end();
+}
+
+savintsev::Project::const_iterator savintsev::Project::begin() const noexcept
+{
+  return layers_.begin();
+}
+
+savintsev::Project::const_iterator savintsev::Project::end() const noexcept
+{
+  return layers_.end();
+}
+
+bool savintsev::Project::empty() const noexcept
+{
+  return layers_.empty();
+}
+
+size_t savintsev::Project::size() const noexcept
+{
+  return layers_.size();
+}
+
+// layers sharing a name are indexed in layer order, so the first of them is found
+savintsev::Project::iterator savintsev::Project::find(const std::string & name)
+{
+  auto entry = index_.find(name);
+  if (entry == index_.end())
+  {
+    return layers_.end();
+  }
+  return entry->second.front();
+}
+
+void savintsev::Project::push_back(const Layer & layer)
+{
+  insert(layers_.end(), layer);
+}
+
+void savintsev::Project::append(const Project & rhs)
+{
+  auto it = rhs.begin();
+  for (size_t n = rhs.size(); n > 0; --n, ++it)
+  {
+    std::unique_ptr< Shape > copy(pack_shape(geometry_, *it->second));
+    if (!copy)
+    {
+      copy.reset(it->second->clone());
+    }
+    push_back({it->first, copy.get()});
+    copy.release();
+  }
+}
+
+// the project takes over the shape: one living outside of its geometry store
+// is repacked there and the original is deleted
+savintsev::Project::iterator savintsev::Project::insert(const_iterator pos, const Layer & layer)
+{
+  std::unique_ptr< Shape > packed;
+  if (layer.second && !is_packed(layer.second))
+  {
+    packed.reset(pack_shape(geometry_, *layer.second));
+  }
+  Layer stored = {layer.first, packed ? packed.get() : layer.second};
+  iterator it = layers_.insert(pos, stored);
+  try
+  {
+    index_layer(it);
+  }
+  catch (...)
+  {
+    layers_.erase(it);
+    throw;
+  }
+  if (packed)
+  {
+    packed.release();
+    delete layer.second;
+  }
+  else if (layer.second && !is_packed(layer.second))
+  {
+    ++loose_;
+  }
+  return it;
+}
+
+savintsev::Project::iterator savintsev::Project::erase(iterator pos)
+{
+  unindex_layer(pos);
+  if (pos->second && !is_packed(pos->second))
+  {
+    --loose_;
+  }
+  return layers_.erase(pos);
+}
+
+void savintsev::Project::clear() noexcept
+{
+  layers_.clear();
+  index_.clear();
+  loose_ = 0;
+}
+
+void savintsev::Project::splice(const_iterator pos, iterator it) noexcept
+{
+  if (pos == it)
+  {
+    return;
+  }
+  layers_.splice(pos, layers_, it);
+  relocate_entry(it);
+}
+
+void savintsev::Project::swap_layers(iterator lhs, iterator rhs)
+{
+  Entries::iterator lhs_entry = locate_entry(lhs);
+  Entries::iterator rhs_entry = locate_entry(rhs);
+  std::iter_swap(lhs, rhs);
+  if (lhs_entry != Entries::iterator())
+  {
+    *lhs_entry = rhs;
+  }
+  if (rhs_entry != Entries::iterator())
+  {
+    *rhs_entry = lhs;
+  }
+  relocate_entry(lhs);
+  relocate_entry(rhs);
+}
+
+void savintsev::Project::rename(iterator it, const std::string & name)
+{
+  unindex_layer(it);
+  it->second->set_name(name);
+  index_layer(it);
+}
+
+void savintsev::Project::reverse() noexcept
+{
+  layers_.reverse();
+  for (auto it = index_.begin(); it != index_.end(); ++it)
+  {
+    it->second.reverse();
+  }
+}
+
+void savintsev::Project::move_all(double dx, double dy)
+{
+  geometry_->translate(dx, dy);
+  for (auto it = layers_.begin(); loose_ != 0 && it != layers_.end(); ++it)
+  {
+    if (it->second && !is_packed(it->second))
+    {
+      it->second->move(dx, dy);
+    }
+  }
+}
+
+bool savintsev::Project::is_packed(const Shape * shape) const noexcept
+{
+  const PackedShape * packed = dynamic_cast< const PackedShape * >(shape);
+  return packed && packed->is_stored_in(*geometry_);
+}
+
+void savintsev::Project::index_layer(iterator it)
+{
+  if (!it->second)
+  {
+    return;
+  }
+  std::string name = it->second->get_name();
+  auto entry = index_.find(name);
+  if (entry == index_.end())
+  {
+    index_.insert({name, Entries{it}});
+    return;
+  }
+  entry->second.insert(next_entry(entry->second, it), it);
+}
+
+void savintsev::Project::unindex_layer(iterator it)
+{
+  if (!it->second)
+  {
+    return;
+  }
+  std::string name = it->second->get_name();
+  auto entry = index_.find(name);
+  if (entry == index_.end())
+  {
+    return;
+  }
+  entry->second.remove(it);
+  if (entry->second.empty())
+  {
+    index_.erase(name);
+  }
+}
+
+void savintsev::Project::relocate_entry(iterator it) noexcept
+{
+  if (!it->second)
+  {
+    return;
+  }
+  Entries & entries = index_.find(it->second->get_name())->second;
+  if (entries.size() == 1)
+  {
+    return;
+  }
+  Entries::iterator entry = locate_entry(it);
+  Entries::iterator pos = next_entry(entries, it);
+  if (entry != pos && std::next(entry) != pos)
+  {
+    entries.splice(pos, entries, entry);
+  }
+}
+
+savintsev::Project::Entries::iterator savintsev::Project::locate_entry(iterator it) noexcept
+{
+  if (!it->second)
+  {
+    return Entries::iterator();
+  }
+  Entries & entries = index_.find(it->second->get_name())->second;
+  return std::find(entries.begin(), entries.end(), it);
+}
+
+// walks out from the layer to its nearest namesake, which is the closer of the two;
+// layers with unique names never get here
+savintsev::Project::Entries::iterator savintsev::Project::next_entry(Entries & entries, iterator it) noexcept
+{
+  std::string name = it->second->get_name();
+  iterator before = it;
+  iterator after = it;
+  while (true)
+  {
+    if (++after == layers_.end())
+    {
+      return entries.end();
+    }
+    if (after->second && after->second->get_name() == name)
+    {
+      return std::find(entries.begin(), entries.end(), after);
+    }
+    if (before == layers_.begin())
+    {
+      return entries.begin();
+    }
+    if ((--before)->second && before->second->get_name() == name)
+    {
+      return std::next(std::find(entries.begin(), entries.end(), before));
+    }
+  }
+}
+
+void savintsev::Project::rebuild_index()
+{
+  index_.clear();
+  for (auto it = layers_.begin(); it != layers_.end(); ++it)
+  {
+    if (it->second)
+    {
+      index_[it->second->get_name()].push_back(it);
+    }
+  }
+}
@@ -1,14 +1,68 @@
 #ifndef PROJECT_BODY_HPP
 #define PROJECT_BODY_HPP
+#include <memory>
 #include <string>
 #include <list.hpp>
 #include <shape.hpp>
+#include <geometry-store.hpp>
 #include <two-three-tree.h>
 
 namespace savintsev
 {
   using Layer = std::pair< std::string, Shape * >;
-  using Project = List< Layer >;
+
+  class Project
+  {
+  public:
+    using value_type = Layer;
+    using iterator = List< Layer >::iterator;
+    using const_iterator = List< Layer >::const_iterator;
+
+    Project();
+    Project(const Project & rhs);
+    Project(Project && rhs) = default;
+    Project & operator=(const Project & rhs);
+    Project & operator=(Project && rhs) = default;
+
+    iterator begin() noexcept;
+    iterator end() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+
+    iterator find(const std::string & name);
+
+    void push_back(const Layer & layer);
+    void append(const Project & rhs);
+    iterator insert(const_iterator pos, const Layer & layer);
+    iterator erase(iterator pos);
+    void clear() noexcept;
+
+    void splice(const_iterator pos, iterator it) noexcept;
+    void swap_layers(iterator lhs, iterator rhs);
+    void rename(iterator it, const std::string & name);
+    void reverse() noexcept;
+    void move_all(double dx, double dy);
+  private:
+    using Entries = List< iterator >;
+
+    List< Layer > layers_;
+    TwoThreeTree< std::string, Entries > index_;
+    std::shared_ptr< GeometryStore > geometry_;
+    size_t loose_;
+
+    bool is_packed(const Shape * shape) const noexcept;
+
+    void index_layer(iterator it);
+    void unindex_layer(iterator it);
+    void relocate_entry(iterator it) noexcept;
+    Entries::iterator locate_entry(iterator it) noexcept;
+    Entries::iterator next_entry(Entries & entries, iterator it) noexcept;
+    void rebuild_index();
+  };
+
   using Projects = TwoThreeTree< std::string, Project >;
 }
 
@@ -63,17 +63,6 @@ namespace
       savintsev::write_savi_file(entry.first, entry.second);
     }
   };
-  struct ShapeNameEquals
-  {
-    const std::string & name;
-    ShapeNameEquals(const std::string & n):
-      name(n)
-    {}
-    bool operator()(const savintsev::Layer & layer) const
-    {
-      return layer.second && layer.second->get_name() == name;
-    }
-  };
   std::string make_sh(std::istream & in, savintsev::Projects & projs, std::string shape_name)
   {
     std::string proj;
@@ -87,29 +76,6 @@ namespace
     projs[proj].push_back(std::make_pair(shape_name, shape));
     return proj;
   }
-  struct CloneLayer
-  {
-    CloneLayer() = default;
-
-    savintsev::Layer operator()(const savintsev::Layer & layer) const
-    {
-      return {layer.first, layer.second->clone()};
-    }
-  };
-  struct MoveLayer
-  {
-    MoveLayer(double dx, double dy):
-      dx_(dx),
-      dy_(dy)
-    {}
-    void operator()(savintsev::Layer & layer) const
-    {
-      layer.second->move(dx_, dy_);
-    }
-  private:
-    double dx_;
-    double dy_;
-  };
   struct Deleter
   {
     void operator()(savintsev::Layer & layer) const
@@ -134,8 +100,8 @@ void savintsev::merge(std::istream & in, std::ostream & out, Projects & projs)
   const Project & first = projs.at(src1);
   const Project & second = projs.at(src2);
 
-  std::transform(first.begin(), first.end(), std::back_inserter(target), CloneLayer());
-  std::transform(second.begin(), second.end(), std::back_inserter(target), CloneLayer());
+  target.append(first);
+  target.append(second);
 
   out << "Project \"" << src1 << "\" has been successfully merged with project \"" << src2 << "\"\n";
 }
@@ -163,11 +129,12 @@ void savintsev::delete_shape(std::istream & in, std::ostream & out, Projects & p
   std::string proj, shape_name;
   in >> proj >> shape_name;
   Project & pr = projs.at(proj);
-  auto it = std::find_if(pr.begin(), pr.end(), ShapeNameEquals(shape_name));
+  auto it = pr.find(shape_name);
   if (it != pr.end())
   {
-    delete it->second;
+    Shape * shape = it->second;
     pr.erase(it);
+    delete shape;
     out << "\"" << shape_name << "\" was successfully removed from \"" << proj << "\"\n";
     return;
   }
@@ -183,13 +150,13 @@ void savintsev::copy_proj_or_shape(std::istream & in, std::ostream & out, Projec
   {
     Project & source = projs.at(proj);
     Project & target = projs[second];
-    std::transform(source.begin(), source.end(), std::back_inserter(target), CloneLayer());
+    target.append(source);
     out << "Project \"" << proj << "\" was successfully copied to \"" << second << "\"\n";
   }
   else
   {
     Project & pr = projs.at(proj);
-    auto it = std::find_if(pr.begin(), pr.end(), ShapeNameEquals(second));
+    auto it = pr.find(second);
     if (it == pr.end())
     {
       out << "\"" << second << "\" not found in project \"" << proj << "\"\n";
@@ -210,7 +177,7 @@ void savintsev::insert_shape(std::istream & in, std::ostream & out, Projects & p
   Project & from = projs.at(src_proj);
   Project & to = projs.at(dest_proj);
 
-  auto it = std::find_if(from.begin(), from.end(), ShapeNameEquals(shape_name));
+  auto it = from.find(shape_name);
   if (it == from.end())
   {
     out << "\"" << shape_name << "\" not found in project \"" << src_proj << "\"\n";
@@ -218,8 +185,8 @@ void savintsev::insert_shape(std::istream & in, std::ostream & out, Projects & p
   }
 
   Shape * cloned = it->second->clone();
-  to.push_back(std::make_pair(it->first, cloned));
   cloned->set_name(shape_name + "_copy");
+  to.push_back(std::make_pair(it->first, cloned));
 
   out << "\"" << shape_name << "\" from \"" << src_proj << "\" was inserted into \"" << dest_proj << "\"\n";
 }
@@ -242,7 +209,7 @@ void savintsev::rename_proj_or_shape(std::istream & in, std::ostream & out, Proj
     const std::string & new_name = third;
 
     Project & pr = projs.at(proj);
-    auto it = std::find_if(pr.begin(), pr.end(), ShapeNameEquals(old_name));
+    auto it = pr.find(old_name);
 
     if (it == pr.end())
     {
@@ -250,7 +217,7 @@ void savintsev::rename_proj_or_shape(std::istream & in, std::ostream & out, Proj
       return;
     }
 
-    it->second->set_name(new_name);
+    pr.rename(it, new_name);
     out << "\"" << old_name << "\" was renamed to \"" << new_name << "\" in project \"" << proj << "\"\n";
   }
 }
@@ -262,7 +229,7 @@ void savintsev::sf(std::istream & in, std::ostream & out, Projects & projs)
   in >> proj >> name >> n;
 
   Project & pr = projs.at(proj);
-  auto it = std::find_if(pr.begin(), pr.end(), ShapeNameEquals(name));
+  auto it = pr.find(name);
 
   if (it == pr.end())
   {
@@ -301,14 +268,14 @@ void savintsev::sf_above(std::istream & in, std::ostream & out, Projects & projs
   in >> proj >> name;
 
   Project & pr = projs.at(proj);
-  auto it = std::find_if(pr.begin(), pr.end(), ShapeNameEquals(name));
+  auto it = pr.find(name);
   if (it == pr.end())
   {
     out << "\"" << name << "\" not found in project \"" << proj << "\"\n";
     return;
   }
 
-  pr.splice(pr.end(), pr, it);
+  pr.splice(pr.end(), it);
   out << "\"" << name << "\" was moved to the top in project \"" << proj << "\"\n";
 }
 
@@ -318,14 +285,14 @@ void savintsev::sf_below(std::istream & in, std::ostream & out, Projects & projs
   in >> proj >> name;
 
   Project & pr = projs.at(proj);
-  auto it = std::find_if(pr.begin(), pr.end(), ShapeNameEquals(name));
+  auto it = pr.find(name);
   if (it == pr.end())
   {
     out << "\"" << name << "\" not found in project \"" << proj << "\"\n";
     return;
   }
 
-  pr.splice(pr.begin(), pr, it);
+  pr.splice(pr.begin(), it);
   out << "\"" << name << "\" was moved to the bottom in project \"" << proj << "\"\n";
 }
 
@@ -336,8 +303,8 @@ void savintsev::swap_shapes(std::istream & in, std::ostream & out, Projects & pr
 
   Project & pr = projs.at(proj);
 
-  auto it1 = std::find_if(pr.begin(), pr.end(), ShapeNameEquals(name1));
-  auto it2 = std::find_if(pr.begin(), pr.end(), ShapeNameEquals(name2));
+  auto it1 = pr.find(name1);
+  auto it2 = pr.find(name2);
 
   if (it1 == pr.end() || it2 == pr.end())
   {
@@ -351,7 +318,7 @@ void savintsev::swap_shapes(std::istream & in, std::ostream & out, Projects & pr
     return;
   }
 
-  std::iter_swap(it1, it2);
+  pr.swap_layers(it1, it2);
   out << "\"" << name1 << "\" and \"" << name2 << "\" were swapped in \"" << proj << "\"\n";
 }
 
@@ -361,7 +328,7 @@ void savintsev::move_abs(std::istream & in, std::ostream & out, Projects & projs
   double x, y;
   in >> proj >> name >> x >> y;
   auto & pr = projs.at(proj);
-  auto it = std::find_if(pr.begin(), pr.end(), ShapeNameEquals(name));
+  auto it = pr.find(name);
   if (it == pr.end())
   {
     out << "\"" << name << "\" not found in project \"" << proj << "\"\n";
@@ -377,7 +344,7 @@ void savintsev::move_rel(std::istream & in, std::ostream & out, Projects & projs
   double dx, dy;
   in >> proj >> name >> dx >> dy;
   auto & pr = projs.at(proj);
-  auto it = std::find_if(pr.begin(), pr.end(), ShapeNameEquals(name));
+  auto it = pr.find(name);
   if (it == pr.end())
   {
     out << "\"" << name << "\" not found in project \"" << proj << "\"\n";
@@ -393,7 +360,7 @@ void savintsev::move_all(std::istream & in, std::ostream & out, Projects & projs
   double dx, dy;
   in >> proj >> dx >> dy;
   auto & pr = projs.at(proj);
-  std::for_each(pr.begin(), pr.end(), MoveLayer(dx, dy));
+  pr.move_all(dx, dy);
   out << "All shapes moved by (" << dx << ", " << dy << ")\n";
 }
 
@@ -403,7 +370,7 @@ void savintsev::scale_shape(std::istream & in, std::ostream & out, Projects & pr
   double k;
   in >> proj >> name >> k;
   auto & pr = projs.at(proj);
-  auto it = std::find_if(pr.begin(), pr.end(), ShapeNameEquals(name));
+  auto it = pr.find(name);
   if (it == pr.end())
   {
     out << "\"" << name << "\" not found in project \"" << proj << "\"\n";
@@ -422,7 +389,7 @@ void savintsev::array_shapes(std::istream & in, std::ostream & out, Projects & p
   in >> proj >> name >> n >> dx >> dy;
 
   auto & pr = projs.at(proj);
-  auto it = std::find_if(pr.begin(), pr.end(), ShapeNameEquals(name));
+  auto it = pr.find(name);
   if (it == pr.end())
   {
     out << "\"" << name << "\" not found in project \"" << proj << "\"\n";
@@ -560,7 +527,7 @@ void savintsev::print_info_about_shape(std::istream & in, std::ostream & out, Pr
   in >> proj >> name;
 
   Project & pr = projs.at(proj);
-  auto it = std::find_if(pr.begin(), pr.end(), ShapeNameEquals(name));
+  auto it = pr.find(name);
   if (it == pr.end())
   {
     out << "Figure \"" << name << "\" not found in project \"" << proj << "\"\n";
@@ -0,0 +1,126 @@
+#include "geometry-store.hpp"
+#include <memory>
+
+namespace
+{
+  void shift(double * values, size_t n, double d) noexcept
+  {
+    for (size_t i = 0; i < n; ++i)
+    {
+      values[i] += d;
+    }
+  }
+}
+
+size_t savintsev::get_points_count(shape_kind kind) noexcept
+{
+  return kind == shape_kind::rectangle ? 2 : 4;
+}
+
+savintsev::GeometryStore::GeometryStore():
+  xs_(),
+  ys_(),
+  slots_(),
+  free_pairs_(),
+  free_quads_(),
+  live_(0)
+{}
+
+size_t savintsev::GeometryStore::allocate(shape_kind kind, const point_t * ps)
+{
+  size_t count = get_points_count(kind);
+  Array< size_t > & free_list = get_free_list(count);
+  size_t slot = 0;
+  if (!free_list.empty())
+  {
+    slot = free_list.back();
+    free_list.pop_back();
+    slots_[slot].kind = kind;
+  }
+  else
+  {
+    slot = slots_.size();
+    size_t offset = xs_.size();
+    for (size_t i = 0; i < count; ++i)
+    {
+      xs_.push_back(0.0);
+      ys_.push_back(0.0);
+    }
+    slots_.push_back(Slot{kind, offset});
+  }
+  set_points(slot, ps);
+  ++live_;
+  return slot;
+}
+
+void savintsev::GeometryStore::release(size_t slot) noexcept
+{
+  Array< size_t > & free_list = get_free_list(get_points_count(slots_[slot].kind));
+  try
+  {
+    free_list.push_back(slot);
+  }
+  catch (...)
+  {
+    // the slot is just never reused then
+  }
+  --live_;
+}
+
+savintsev::shape_kind savintsev::GeometryStore::get_kind(size_t slot) const noexcept
+{
+  return slots_[slot].kind;
+}
+
+size_t savintsev::GeometryStore::get_points(size_t slot, point_t * ps) const noexcept
+{
+  const Slot & s = slots_[slot];
+  size_t count = get_points_count(s.kind);
+  if (ps)
+  {
+    for (size_t i = 0; i < count; ++i)
+    {
+      ps[i] = {xs_[s.offset + i], ys_[s.offset + i]};
+    }
+  }
+  return count;
+}
+
+void savintsev::GeometryStore::set_points(size_t slot, const point_t * ps) noexcept
+{
+  const Slot & s = slots_[slot];
+  for (size_t i = 0; i < get_points_count(s.kind); ++i)
+  {
+    xs_[s.offset + i] = ps[i].x;
+    ys_[s.offset + i] = ps[i].y;
+  }
+}
+
+void savintsev::GeometryStore::translate(size_t slot, double dx, double dy) noexcept
+{
+  const Slot & s = slots_[slot];
+  size_t count = get_points_count(s.kind);
+  shift(std::addressof(xs_[s.offset]), count, dx);
+  shift(std::addressof(ys_[s.offset]), count, dy);
+}
+
+void savintsev::GeometryStore::translate(double dx, double dy) noexcept
+{
+  if (xs_.empty())
+  {
+    return;
+  }
+  // released slots are shifted as well, one pass over each contiguous array is cheaper than skipping them
+  shift(std::addressof(xs_.front()), xs_.size(), dx);
+  shift(std::addressof(ys_.front()), ys_.size(), dy);
+}
+
+size_t savintsev::GeometryStore::size() const noexcept
+{
+  return live_;
+}
+
+savintsev::Array< size_t > & savintsev::GeometryStore::get_free_list(size_t count) noexcept
+{
+  return count == 2 ? free_pairs_ : free_quads_;
+}
@@ -0,0 +1,52 @@
+#ifndef GEOMETRY_STORE_HPP
+#define GEOMETRY_STORE_HPP
+#include <cstddef>
+#include "base-types.hpp"
+#include "dynamic-array.hpp"
+
+namespace savintsev
+{
+  enum class shape_kind
+  {
+    rectangle,
+    complexquad,
+    concave
+  };
+
+  size_t get_points_count(shape_kind kind) noexcept;
+
+  class GeometryStore
+  {
+  public:
+    GeometryStore();
+
+    size_t allocate(shape_kind kind, const point_t * ps);
+    void release(size_t slot) noexcept;
+
+    shape_kind get_kind(size_t slot) const noexcept;
+    size_t get_points(size_t slot, point_t * ps) const noexcept;
+    void set_points(size_t slot, const point_t * ps) noexcept;
+
+    void translate(size_t slot, double dx, double dy) noexcept;
+    void translate(double dx, double dy) noexcept;
+
+    size_t size() const noexcept;
+  private:
+    struct Slot
+    {
+      shape_kind kind;
+      size_t offset;
+    };
+
+    Array< double > xs_;
+    Array< double > ys_;
+    Array< Slot > slots_;
+    Array< size_t > free_pairs_;
+    Array< size_t > free_quads_;
+    size_t live_;
+
+    Array< size_t > & get_free_list(size_t count) noexcept;
+  };
+}
+
+#endif
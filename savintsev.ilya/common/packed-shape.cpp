@@ -0,0 +1,154 @@
+#include "packed-shape.hpp"
+#include <algorithm>
+#include <cmath>
+#include "rectangle.hpp"
+#include "complexquad.hpp"
+#include "concave.hpp"
+#include "geometry-utils.hpp"
+
+namespace
+{
+  savintsev::rectangle_t get_frame(savintsev::shape_kind kind, const savintsev::point_t * ps)
+  {
+    using savintsev::shape_kind;
+    if (kind == shape_kind::rectangle)
+    {
+      double centerByX = ps[0].x + ((ps[1].x - ps[0].x) / 2.);
+      double centerByY = ps[0].y + ((ps[1].y - ps[0].y) / 2.);
+      return {ps[1].x - ps[0].x, ps[1].y - ps[0].y, {centerByX, centerByY}};
+    }
+    double mostLeft = 0.0;
+    double mostRight = 0.0;
+    double mostLow = 0.0;
+    double mostHigh = 0.0;
+    if (kind == shape_kind::complexquad)
+    {
+      mostLeft = std::min({ps[0].x, ps[1].x, ps[2].x, ps[3].x});
+      mostRight = std::max({ps[0].x, ps[1].x, ps[2].x, ps[3].x});
+      mostLow = std::min({ps[0].y, ps[1].y, ps[2].y, ps[3].y});
+      mostHigh = std::max({ps[0].y, ps[1].y, ps[2].y, ps[3].y});
+    }
+    else
+    {
+      mostLeft = std::fmin(ps[0].x, std::fmin(ps[1].x, ps[2].x));
+      mostRight = std::fmax(ps[0].x, std::fmax(ps[1].x, ps[2].x));
+      mostLow = std::fmin(ps[0].y, std::fmin(ps[1].y, ps[2].y));
+      mostHigh = std::fmax(ps[0].y, std::fmax(ps[1].y, ps[2].y));
+    }
+    savintsev::point_t center = {mostLeft + (mostRight - mostLeft) / 2, mostLow + (mostHigh - mostLow) / 2};
+    return {mostRight - mostLeft, mostHigh - mostLow, center};
+  }
+}
+
+savintsev::PackedShape::PackedShape(std::shared_ptr< GeometryStore > store, shape_kind kind, const point_t * ps, std::string name):
+  Shape(std::move(name)),
+  store_(std::move(store)),
+  slot_(store_->allocate(kind, ps))
+{}
+
+savintsev::PackedShape::~PackedShape()
+{
+  store_->release(slot_);
+}
+
+savintsev::Shape * savintsev::PackedShape::clone() const
+{
+  point_t ps[4];
+  store_->get_points(slot_, ps);
+  return new PackedShape(store_, get_kind(), ps, name_);
+}
+
+savintsev::rectangle_t savintsev::PackedShape::get_frame_rect() const
+{
+  point_t ps[4];
+  store_->get_points(slot_, ps);
+  return get_frame(get_kind(), ps);
+}
+
+size_t savintsev::PackedShape::get_all_points(point_t * ps) const
+{
+  return store_->get_points(slot_, ps);
+}
+
+void savintsev::PackedShape::move(point_t p)
+{
+  point_t anchor = get_anchor();
+  store_->translate(slot_, p.x - anchor.x, p.y - anchor.y);
+}
+
+void savintsev::PackedShape::move(double x, double y)
+{
+  store_->translate(slot_, x, y);
+}
+
+void savintsev::PackedShape::unsafe_scale(double k) noexcept
+{
+  point_t ps[4];
+  size_t count = store_->get_points(slot_, ps);
+  point_t anchor = get_anchor();
+  if (get_kind() == shape_kind::concave)
+  {
+    count = 3;
+  }
+  for (size_t i = 0; i < count; ++i)
+  {
+    ps[i] = {anchor.x - (anchor.x - ps[i].x) * k, anchor.y - (anchor.y - ps[i].y) * k};
+  }
+  store_->set_points(slot_, ps);
+}
+
+savintsev::shape_kind savintsev::PackedShape::get_kind() const noexcept
+{
+  return store_->get_kind(slot_);
+}
+
+bool savintsev::PackedShape::is_stored_in(const GeometryStore & store) const noexcept
+{
+  return store_.get() == std::addressof(store);
+}
+
+savintsev::point_t savintsev::PackedShape::get_anchor() const noexcept
+{
+  point_t ps[4];
+  store_->get_points(slot_, ps);
+  shape_kind kind = get_kind();
+  if (kind == shape_kind::rectangle)
+  {
+    return get_frame(kind, ps).pos;
+  }
+  if (kind == shape_kind::concave)
+  {
+    return ps[3];
+  }
+  point_t center = {0.0, 0.0};
+  findLinesIntersect(ps[0], ps[1], ps[2], ps[3], center);
+  return center;
+}
+
+savintsev::Shape * savintsev::pack_shape(const std::shared_ptr< GeometryStore > & store, const Shape & shape)
+{
+  shape_kind kind = shape_kind::rectangle;
+  if (const PackedShape * packed = dynamic_cast< const PackedShape * >(std::addressof(shape)))
+  {
+    kind = packed->get_kind();
+  }
+  else if (dynamic_cast< const Rectangle * >(std::addressof(shape)))
+  {
+    kind = shape_kind::rectangle;
+  }
+  else if (dynamic_cast< const Complexquad * >(std::addressof(shape)))
+  {
+    kind = shape_kind::complexquad;
+  }
+  else if (dynamic_cast< const Concave * >(std::addressof(shape)))
+  {
+    kind = shape_kind::concave;
+  }
+  else
+  {
+    return nullptr;
+  }
+  point_t ps[4];
+  shape.get_all_points(ps);
+  return new PackedShape(store, kind, ps, shape.get_name());
+}
@@ -0,0 +1,39 @@
+#ifndef PACKED_SHAPE_HPP
+#define PACKED_SHAPE_HPP
+#include <memory>
+#include <string>
+#include "shape.hpp"
+#include "geometry-store.hpp"
+
+namespace savintsev
+{
+  class PackedShape final: public Shape
+  {
+  public:
+    PackedShape(std::shared_ptr< GeometryStore > store, shape_kind kind, const point_t * ps, std::string name = "");
+    PackedShape(const PackedShape &) = delete;
+    PackedShape & operator=(const PackedShape &) = delete;
+    ~PackedShape() override;
+
+    Shape * clone() const override;
+
+    rectangle_t get_frame_rect() const override;
+    size_t get_all_points(point_t * ps) const override;
+
+    void move(point_t p) override;
+    void move(double x, double y) override;
+    void unsafe_scale(double k) noexcept override;
+
+    shape_kind get_kind() const noexcept;
+    bool is_stored_in(const GeometryStore & store) const noexcept;
+  private:
+    std::shared_ptr< GeometryStore > store_;
+    size_t slot_;
+
+    point_t get_anchor() const noexcept;
+  };
+
+  Shape * pack_shape(const std::shared_ptr< GeometryStore > & store, const Shape & shape);
+}
+
+#endif
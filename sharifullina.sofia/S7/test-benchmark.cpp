@@ -0,0 +1,87 @@
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+#include <hash_table/concurrentHashTable.hpp>
+
+namespace
+{
+  using Table = sharifullina::ConcurrentHashTable< int, int >;
+
+  const int keyRange = 20000;
+  const int totalOperations = 200000;
+
+  void runWorker(Table & table, unsigned seed, int operations, int readPercent, size_t & hits)
+  {
+    std::minstd_rand generator(seed);
+    size_t localHits = 0;
+    for (int i = 0; i < operations; ++i)
+    {
+      int key = static_cast< int >(generator() % keyRange);
+      int kind = static_cast< int >(generator() % 100);
+      if (kind < readPercent)
+      {
+        localHits += table.contains(key);
+      }
+      else if (kind % 2 == 0)
+      {
+        table.insert(key, i);
+      }
+      else
+      {
+        table.erase(key);
+      }
+    }
+    hits = localHits;
+  }
+
+  double measure(size_t stripes, int threadCount, int readPercent, size_t & hits)
+  {
+    Table table(stripes);
+    for (int key = 0; key < keyRange; key += 2)
+    {
+      table.insert(key, key);
+    }
+    std::vector< size_t > threadHits(threadCount, 0);
+    std::vector< std::thread > threads;
+    auto start = std::chrono::steady_clock::now();
+    for (int t = 0; t < threadCount; ++t)
+    {
+      threads.emplace_back(runWorker, std::ref(table), t + 1, totalOperations / threadCount, readPercent, std::ref(threadHits[t]));
+    }
+    for (size_t i = 0; i < threads.size(); ++i)
+    {
+      threads[i].join();
+    }
+    std::chrono::duration< double, std::milli > time = std::chrono::steady_clock::now() - start;
+    hits = 0;
+    for (size_t i = 0; i < threadHits.size(); ++i)
+    {
+      hits += threadHits[i];
+    }
+    return time.count();
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(concurrent_benchmark, *boost::unit_test::disabled())
+
+BOOST_AUTO_TEST_CASE(benchmark_mixed_workloads)
+{
+  const int readPercents[] = {90, 50};
+  const int threadCounts[] = {1, 2, 4, 8, 16};
+  for (int readPercent: readPercents)
+  {
+    for (int threadCount: threadCounts)
+    {
+      size_t lockedHits = 0;
+      size_t stripedHits = 0;
+      double locked = measure(1, threadCount, readPercent, lockedHits);
+      double striped = measure(16, threadCount, readPercent, stripedHits);
+      BOOST_TEST_MESSAGE(readPercent << "% reads, " << threadCount << " threads: single lock " << locked
+          << " ms (" << lockedHits << " hits), 16 stripes " << striped << " ms (" << stripedHits << " hits)");
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
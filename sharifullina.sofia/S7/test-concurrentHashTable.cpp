@@ -0,0 +1,192 @@
+#include <boost/test/unit_test.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+#include <hash_table/concurrentHashTable.hpp>
+
+BOOST_AUTO_TEST_SUITE(concurrentHashTable)
+
+BOOST_AUTO_TEST_CASE(singleThread)
+{
+  sharifullina::ConcurrentHashTable< int, std::string > table(5);
+  BOOST_TEST(table.stripeCount() == 8);
+  BOOST_TEST(table.empty());
+  BOOST_TEST(table.insert(1, "one"));
+  BOOST_TEST(!table.insert(1, "uno"));
+  BOOST_TEST(table.insert(2, "two"));
+  std::string value;
+  BOOST_TEST(table.find(1, value));
+  BOOST_TEST(value == "one");
+  BOOST_TEST(!table.find(3, value));
+  BOOST_TEST(table.update(2, [](std::string & str)
+  {
+    str += "!";
+  }));
+  BOOST_TEST(!table.update(3, [](std::string &) {}));
+  BOOST_TEST(table.find(2, value));
+  BOOST_TEST(value == "two!");
+  BOOST_TEST(table.erase(1) == 1);
+  BOOST_TEST(table.erase(1) == 0);
+  BOOST_TEST(!table.contains(1));
+  BOOST_TEST(table.size() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(parallelInsert)
+{
+  const int threadCount = 8;
+  const int perThread = 5000;
+  sharifullina::ConcurrentHashTable< int, int > table;
+  std::vector< std::thread > threads;
+  for (int t = 0; t < threadCount; ++t)
+  {
+    threads.emplace_back([&table, t, perThread]()
+    {
+      for (int i = 0; i < perThread; ++i)
+      {
+        table.insert(t * perThread + i, t);
+      }
+    });
+  }
+  for (size_t i = 0; i < threads.size(); ++i)
+  {
+    threads[i].join();
+  }
+  BOOST_TEST(table.size() == static_cast< size_t >(threadCount * perThread));
+  size_t wrong = 0;
+  for (int key = 0; key < threadCount * perThread; ++key)
+  {
+    int value = -1;
+    wrong += !table.find(key, value) || value != key / perThread;
+  }
+  BOOST_TEST(wrong == 0);
+}
+
+BOOST_AUTO_TEST_CASE(parallelCount)
+{
+  const int threadCount = 8;
+  const int keys = 100;
+  const int rounds = 50;
+  sharifullina::ConcurrentHashTable< std::string, int > table(4);
+  std::vector< std::thread > threads;
+  for (int t = 0; t < threadCount; ++t)
+  {
+    threads.emplace_back([&table]()
+    {
+      for (int r = 0; r < rounds; ++r)
+      {
+        for (int k = 0; k < keys; ++k)
+        {
+          table.insertOrUpdate(std::to_string(k), 1, [](int & count)
+          {
+            ++count;
+          });
+        }
+      }
+    });
+  }
+  for (size_t i = 0; i < threads.size(); ++i)
+  {
+    threads[i].join();
+  }
+  BOOST_TEST(table.size() == static_cast< size_t >(keys));
+  int total = 0;
+  table.forEach([&total](const std::pair< std::string, int > & item)
+  {
+    total += item.second;
+  });
+  BOOST_TEST(total == threadCount * keys * rounds);
+}
+
+BOOST_AUTO_TEST_CASE(parallelEraseChurn)
+{
+  const int threadCount = 8;
+  const int perThread = 2000;
+  const int rounds = 5;
+  sharifullina::ConcurrentHashTable< int, int > table(4);
+  std::vector< std::thread > threads;
+  for (int t = 0; t < threadCount; ++t)
+  {
+    threads.emplace_back([&table, t, perThread, rounds]()
+    {
+      for (int r = 0; r < rounds; ++r)
+      {
+        for (int i = 0; i < perThread; ++i)
+        {
+          table.insert(t * perThread + i, r);
+        }
+        for (int i = 1; i < perThread; i += 2)
+        {
+          table.erase(t * perThread + i);
+        }
+      }
+    });
+  }
+  for (size_t i = 0; i < threads.size(); ++i)
+  {
+    threads[i].join();
+  }
+  BOOST_TEST(table.size() == static_cast< size_t >(threadCount * perThread / 2));
+  size_t wrong = 0;
+  for (int key = 0; key < threadCount * perThread; ++key)
+  {
+    int value = -1;
+    bool found = table.find(key, value);
+    wrong += (key % 2 == 0) ? (!found || value != 0) : found;
+  }
+  BOOST_TEST(wrong == 0);
+}
+
+BOOST_AUTO_TEST_CASE(readersSeeStableKeys)
+{
+  const int stableKeys = 1000;
+  const int writerCount = 4;
+  const int readerCount = 4;
+  const int perWriter = 5000;
+  sharifullina::ConcurrentHashTable< int, int > table(2);
+  for (int key = 0; key < stableKeys; ++key)
+  {
+    table.insert(key, key);
+  }
+  std::vector< size_t > misses(readerCount, 0);
+  std::vector< std::thread > threads;
+  for (int t = 0; t < writerCount; ++t)
+  {
+    threads.emplace_back([&table, t, stableKeys, perWriter]()
+    {
+      int first = stableKeys + t * perWriter;
+      for (int i = 0; i < perWriter; ++i)
+      {
+        table.insert(first + i, i);
+        if (i % 4 != 0)
+        {
+          table.erase(first + i);
+        }
+      }
+    });
+  }
+  for (int t = 0; t < readerCount; ++t)
+  {
+    threads.emplace_back([&table, &misses, t, stableKeys]()
+    {
+      for (int r = 0; r < 20; ++r)
+      {
+        for (int key = 0; key < stableKeys; ++key)
+        {
+          int value = -1;
+          misses[t] += !table.find(key, value) || value != key;
+        }
+      }
+    });
+  }
+  for (size_t i = 0; i < threads.size(); ++i)
+  {
+    threads[i].join();
+  }
+  for (size_t i = 0; i < misses.size(); ++i)
+  {
+    BOOST_TEST(misses[i] == 0);
+  }
+  BOOST_TEST(table.size() == static_cast< size_t >(stableKeys + writerCount * perWriter / 4));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1,4 +1,5 @@
 #include <boost/test/unit_test.hpp>
+#include <memory>
 #include <sstream>
 #include <hash_table/hashTable.hpp>
 
@@ -147,6 +148,48 @@ BOOST_AUTO_TEST_CASE(erase)
   BOOST_TEST(out2.str() == "1 one");
 }
 
+BOOST_AUTO_TEST_CASE(eraseKeepsCollisions)
+{
+  sharifullina::HashTable< int, int > hashTable;
+  for (int i = 0; i < 1000; ++i)
+  {
+    hashTable.insert(i * 7919 % 100003, i);
+  }
+  for (int i = 0; i < 1000; i += 2)
+  {
+    hashTable.erase(i * 7919 % 100003);
+  }
+  BOOST_TEST(hashTable.size() == 500);
+  size_t found = 0;
+  for (int i = 0; i < 1000; ++i)
+  {
+    found += hashTable.find(i * 7919 % 100003) != hashTable.end();
+  }
+  BOOST_TEST(found == 500);
+  sharifullina::HashTable< int, int > copy(hashTable);
+  BOOST_TEST(copy.at(1 * 7919 % 100003) == 1);
+  BOOST_TEST(copy.at(999 * 7919 % 100003) == 999);
+}
+
+BOOST_AUTO_TEST_CASE(eraseChurn)
+{
+  sharifullina::HashTable< int, std::shared_ptr< int > > hashTable;
+  std::shared_ptr< int > value = std::make_shared< int >(0);
+  size_t erased = 0;
+  for (int i = 0; i < 1000; ++i)
+  {
+    hashTable.insert(i, value);
+    erased += hashTable.erase(i);
+  }
+  BOOST_TEST(erased == 1000);
+  BOOST_TEST(hashTable.empty());
+  BOOST_TEST(value.use_count() == 1);
+  hashTable.insert(-1, value);
+  BOOST_TEST(hashTable.loadFactor() == 0.1f);
+  bool missing = hashTable.find(999) == hashTable.end();
+  BOOST_TEST(missing);
+}
+
 BOOST_AUTO_TEST_CASE(swap)
 {
   sharifullina::HashTable< int, std::string > hashTable1;
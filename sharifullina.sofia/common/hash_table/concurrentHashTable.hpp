@@ -0,0 +1,181 @@
+#ifndef CONCURRENT_HASH_TABLE_HPP
+#define CONCURRENT_HASH_TABLE_HPP
+
+#include <cstdint>
+#include <mutex>
+#include "hashTable.hpp"
+
+namespace sharifullina
+{
+  template< class Key, class T, class HS1 = std::hash< Key >, class HS2 = detail::XXHash< Key >, class EQ = std::equal_to< Key > >
+  struct ConcurrentHashTable
+  {
+    explicit ConcurrentHashTable(size_t stripes = 16);
+    ConcurrentHashTable(const ConcurrentHashTable & rhs) = delete;
+    ~ConcurrentHashTable();
+
+    ConcurrentHashTable & operator=(const ConcurrentHashTable & rhs) = delete;
+
+    size_t size() const;
+    bool empty() const;
+    size_t stripeCount() const noexcept;
+
+    bool insert(const Key & key, const T & value);
+    template< class F >
+    bool insertOrUpdate(const Key & key, const T & value, F f);
+    template< class F >
+    bool update(const Key & key, F f);
+    size_t erase(const Key & key);
+
+    bool contains(const Key & key) const;
+    bool find(const Key & key, T & value) const;
+    template< class F >
+    void forEach(F f) const;
+
+  private:
+    struct Stripe
+    {
+      mutable std::mutex mutex;
+      HashTable< Key, T, HS1, HS2, EQ > table;
+    };
+
+    Stripe * stripes_;
+    size_t mask_;
+
+    Stripe & stripeFor(const Key & key) const;
+  };
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  ConcurrentHashTable< Key, T, HS1, HS2, EQ >::ConcurrentHashTable(size_t stripes):
+    stripes_(nullptr),
+    mask_(0)
+  {
+    size_t count = 1;
+    while (count < stripes)
+    {
+      count *= 2;
+    }
+    stripes_ = new Stripe[count];
+    mask_ = count - 1;
+  }
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  ConcurrentHashTable< Key, T, HS1, HS2, EQ >::~ConcurrentHashTable()
+  {
+    delete[] stripes_;
+  }
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  size_t ConcurrentHashTable< Key, T, HS1, HS2, EQ >::size() const
+  {
+    size_t result = 0;
+    for (size_t i = 0; i <= mask_; ++i)
+    {
+      std::lock_guard< std::mutex > lock(stripes_[i].mutex);
+      result += stripes_[i].table.size();
+    }
+    return result;
+  }
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  bool ConcurrentHashTable< Key, T, HS1, HS2, EQ >::empty() const
+  {
+    return size() == 0;
+  }
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  size_t ConcurrentHashTable< Key, T, HS1, HS2, EQ >::stripeCount() const noexcept
+  {
+    return mask_ + 1;
+  }
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  typename ConcurrentHashTable< Key, T, HS1, HS2, EQ >::Stripe &
+      ConcurrentHashTable< Key, T, HS1, HS2, EQ >::stripeFor(const Key & key) const
+  {
+    std::uint64_t hash = HS1{}(key);
+    hash *= 0x9E3779B97F4A7C15ull;
+    return stripes_[(hash >> 32) & mask_];
+  }
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  bool ConcurrentHashTable< Key, T, HS1, HS2, EQ >::insert(const Key & key, const T & value)
+  {
+    Stripe & stripe = stripeFor(key);
+    std::lock_guard< std::mutex > lock(stripe.mutex);
+    return stripe.table.insert(key, value).second;
+  }
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  template< class F >
+  bool ConcurrentHashTable< Key, T, HS1, HS2, EQ >::insertOrUpdate(const Key & key, const T & value, F f)
+  {
+    Stripe & stripe = stripeFor(key);
+    std::lock_guard< std::mutex > lock(stripe.mutex);
+    if (stripe.table.insert(key, value).second)
+    {
+      return true;
+    }
+    f(stripe.table.at(key));
+    return false;
+  }
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  template< class F >
+  bool ConcurrentHashTable< Key, T, HS1, HS2, EQ >::update(const Key & key, F f)
+  {
+    Stripe & stripe = stripeFor(key);
+    std::lock_guard< std::mutex > lock(stripe.mutex);
+    if (stripe.table.find(key) == stripe.table.end())
+    {
+      return false;
+    }
+    f(stripe.table.at(key));
+    return true;
+  }
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  size_t ConcurrentHashTable< Key, T, HS1, HS2, EQ >::erase(const Key & key)
+  {
+    Stripe & stripe = stripeFor(key);
+    std::lock_guard< std::mutex > lock(stripe.mutex);
+    return stripe.table.erase(key);
+  }
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  bool ConcurrentHashTable< Key, T, HS1, HS2, EQ >::contains(const Key & key) const
+  {
+    Stripe & stripe = stripeFor(key);
+    std::lock_guard< std::mutex > lock(stripe.mutex);
+    return stripe.table.find(key) != stripe.table.end();
+  }
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  bool ConcurrentHashTable< Key, T, HS1, HS2, EQ >::find(const Key & key, T & value) const
+  {
+    Stripe & stripe = stripeFor(key);
+    std::lock_guard< std::mutex > lock(stripe.mutex);
+    auto it = stripe.table.find(key);
+    if (it == stripe.table.end())
+    {
+      return false;
+    }
+    value = it->second;
+    return true;
+  }
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  template< class F >
+  void ConcurrentHashTable< Key, T, HS1, HS2, EQ >::forEach(F f) const
+  {
+    for (size_t i = 0; i <= mask_; ++i)
+    {
+      std::lock_guard< std::mutex > lock(stripes_[i].mutex);
+      for (auto it = stripes_[i].table.begin(); it != stripes_[i].table.end(); ++it)
+      {
+        f(*it);
+      }
+    }
+  }
+}
+#endif
@@ -1,6 +1,8 @@
 #ifndef HASH_TABLE_HPP
 #define HASH_TABLE_HPP
 
+#include <string>
+#include <utility>
 #include <boost/hash2/xxhash.hpp>
 #include "iterator.hpp"
 #include "hashNode.hpp"
@@ -19,6 +21,28 @@ namespace sharifullina
         return hasher.result();
       }
     };
+
+    template<>
+    struct XXHash< std::string >
+    {
+      size_t operator()(const std::string & key) const
+      {
+        boost::hash2::xxhash_64 hasher;
+        hasher.update(key.data(), key.size());
+        return hasher.result();
+      }
+    };
+
+    inline size_t gcd(size_t a, size_t b) noexcept
+    {
+      while (b != 0)
+      {
+        size_t r = a % b;
+        a = b;
+        b = r;
+      }
+      return a;
+    }
   }
 
   template< class Key, class T, class HS1 = std::hash< Key >, class HS2 = detail::XXHash< Key >, class EQ = std::equal_to< Key > >
@@ -58,8 +82,11 @@ namespace sharifullina
     HashNode< Key, T > * slots_;
     size_t capacity_;
     size_t size_;
+    size_t deleted_;
     float maxLoadFactor_ = 0.7f;
 
+    explicit HashTable(size_t capacity);
+
     std::pair< size_t, size_t > calculatePositions(const Key & key) const noexcept;
     std::pair< size_t, bool > findPosition(const Key & key) const noexcept;
     void rehashIfNeeded();
@@ -67,9 +94,15 @@ namespace sharifullina
 
   template< class Key, class T, class HS1, class HS2, class EQ >
   HashTable< Key, T, HS1, HS2, EQ >::HashTable():
-    slots_(new HashNode< Key, T >[10]),
-    capacity_(10),
-    size_(0)
+    HashTable(10)
+  {}
+
+  template< class Key, class T, class HS1, class HS2, class EQ >
+  HashTable< Key, T, HS1, HS2, EQ >::HashTable(size_t capacity):
+    slots_(new HashNode< Key, T >[capacity]),
+    capacity_(capacity),
+    size_(0),
+    deleted_(0)
   {}
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -82,11 +115,12 @@ namespace sharifullina
   HashTable< Key, T, HS1, HS2, EQ >::HashTable(const HashTable & rhs):
     slots_(new HashNode< Key, T >[rhs.capacity_]),
     capacity_(rhs.capacity_),
-    size_(rhs.size_)
+    size_(rhs.size_),
+    deleted_(rhs.deleted_)
   {
     for (size_t i = 0; i < capacity_; ++i)
     {
-      if (rhs.slots_[i].occupied && !rhs.slots_[i].deleted)
+      if (rhs.slots_[i].occupied)
       {
         slots_[i] = rhs.slots_[i];
       }
@@ -97,11 +131,13 @@ namespace sharifullina
   HashTable< Key, T, HS1, HS2, EQ >::HashTable(HashTable && rhs) noexcept:
     slots_(rhs.slots_),
     capacity_(rhs.capacity_),
-    size_(rhs.size_)
+    size_(rhs.size_),
+    deleted_(rhs.deleted_)
   {
     rhs.slots_ = nullptr;
     rhs.capacity_ = 0;
     rhs.size_ = 0;
+    rhs.deleted_ = 0;
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -124,9 +160,11 @@ namespace sharifullina
       slots_ = rhs.slots_;
       capacity_ = rhs.capacity_;
       size_ = rhs.size_;
+      deleted_ = rhs.deleted_;
       rhs.slots_ = nullptr;
       rhs.capacity_ = 0;
       rhs.size_ = 0;
+      rhs.deleted_ = 0;
     }
     return *this;
   }
@@ -143,6 +181,7 @@ namespace sharifullina
     std::swap(slots_, rhs.slots_);
     std::swap(capacity_, rhs.capacity_);
     std::swap(size_, rhs.size_);
+    std::swap(deleted_, rhs.deleted_);
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
@@ -168,6 +207,10 @@ namespace sharifullina
   {
     size_t h1 = HS1{}(key) % capacity_;
     size_t h2 = HS2{}(key) % (capacity_ - 1) + 1;
+    while (detail::gcd(h2, capacity_) != 1)
+    {
+      h2 = h2 % (capacity_ - 1) + 1;
+    }
     return {h1, h2};
   }
 
@@ -191,9 +234,12 @@ namespace sharifullina
         }
         return {index, true};
       }
-      else if (slots_[index].deleted && deletedSlot == capacity_)
+      else if (slots_[index].deleted)
       {
-        deletedSlot = index;
+        if (deletedSlot == capacity_)
+        {
+          deletedSlot = index;
+        }
       }
       else if (EQ{}(slots_[index].data.first, key))
       {
@@ -201,15 +247,15 @@ namespace sharifullina
       }
     }
 
-    return {capacity_, false};
+    return {deletedSlot, deletedSlot != capacity_};
   }
 
   template< class Key, class T, class HS1, class HS2, class EQ >
   void HashTable< Key, T, HS1, HS2, EQ >::rehashIfNeeded()
   {
-    if (loadFactor() >= maxLoadFactor_)
+    if (static_cast< float >(size_ + deleted_) / capacity_ >= maxLoadFactor_)
     {
-      rehash(capacity_ * 2);
+      rehash(loadFactor() * 2 >= maxLoadFactor_ ? capacity_ * 2 : capacity_);
     }
   }
 
@@ -229,6 +275,10 @@ namespace sharifullina
 
     if (isNew)
     {
+      if (slots_[pos].deleted)
+      {
+        --deleted_;
+      }
       slots_[pos].data = std::make_pair(key, value);
       slots_[pos].occupied = true;
       slots_[pos].deleted = false;
@@ -248,9 +298,10 @@ namespace sharifullina
     }
 
     size_t index = pos.current_;
-    slots_[index].occupied = false;
+    slots_[index].data = std::pair< Key, T >();
     slots_[index].deleted = true;
     --size_;
+    ++deleted_;
 
     ++pos;
     return pos;
@@ -314,37 +365,23 @@ namespace sharifullina
   template< class Key, class T, class HS1, class HS2, class EQ >
   void HashTable< Key, T, HS1, HS2, EQ >::rehash(size_t newCapacity)
   {
-    if (newCapacity <= capacity_)
+    if (newCapacity < capacity_)
     {
       return;
     }
 
-    HashNode< Key, T > * newSlots = new HashNode< Key, T >[newCapacity];
-
+    HashTable tmp(newCapacity);
     for (size_t i = 0; i < capacity_; ++i)
     {
       if (slots_[i].occupied && !slots_[i].deleted)
       {
-        const Key & key = slots_[i].data.first;
-        auto positions = calculatePositions(key);
-        size_t h1 = positions.first;
-        size_t h2 = positions.second;
-
-        for (size_t j = 0; j < newCapacity; ++j)
-        {
-          size_t index = (h1 + j * h2) % newCapacity;
-          if (!newSlots[index].occupied)
-          {
-            newSlots[index] = slots_[i];
-            break;
-          }
-        }
+        size_t index = tmp.findPosition(slots_[i].data.first).first;
+        tmp.slots_[index].data = std::move_if_noexcept(slots_[i].data);
+        tmp.slots_[index].occupied = true;
       }
     }
-
-    delete[] slots_;
-    slots_ = newSlots;
-    capacity_ = newCapacity;
+    tmp.size_ = size_;
+    swap(tmp);
   }
 }
 #endif
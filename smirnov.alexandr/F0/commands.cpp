@@ -1,7 +1,27 @@
 #include "commands.hpp"
 #include <string>
 #include <fstream>
+#include <utility>
 #include "array.hpp"
+#include "dict_image.hpp"
+
+namespace
+{
+  struct EntryPrinter
+  {
+    std::ostream & out;
+    void operator()(const std::pair< std::string, smirnov::Array > & entry) const
+    {
+      out << entry.first << " -";
+      const smirnov::Array & translations = entry.second;
+      for (std::size_t i = 0; i < translations.size(); ++i)
+      {
+        out << " " << translations[i];
+      }
+      out << "\n";
+    }
+  };
+}
 
 void smirnov::printCommand(Dicts & dicts, std::istream & in, std::ostream & out)
 {
@@ -24,16 +44,7 @@ void smirnov::printCommand(Dicts & dicts, std::istream & in, std::ostream & out)
     out << dictName << " is empty.\n";
     return;
   }
-  for (auto it = dict.cbegin(); it != dict.cend(); ++it)
-  {
-    out << it->first << " -";
-    const Array & translations = it->second;
-    for (std::size_t i = 0; i < translations.size(); ++i)
-    {
-      out << " " << translations[i];
-    }
-    out << "\n";
-  }
+  dict.traverseSorted("", EntryPrinter{out});
 }
 
 void smirnov::addCommand(Dicts & dicts, std::istream & in, std::ostream & out)
@@ -88,22 +99,23 @@ void smirnov::translateCommand(Dicts & dicts, std::istream & in, std::ostream &
     return;
   }
   const Dict & dict = dictIt->second;
-  auto wordIt = dict.find(word);
-  if (wordIt == dict.cend())
+  bool found = dict.visit(word, [&out](const std::pair< std::string, Array > & entry)
   {
-    out << "The word " << word << " doesn't exist in " << dictName << "\n";
-    return;
-  }
-  const Array & translations = wordIt->second;
-  for (std::size_t i = 0; i < translations.size(); ++i)
-  {
-    out << translations[i];
-    if (i + 1 < translations.size())
+    const Array & translations = entry.second;
+    for (std::size_t i = 0; i < translations.size(); ++i)
     {
-      out << " ";
+      out << translations[i];
+      if (i + 1 < translations.size())
+      {
+        out << " ";
+      }
     }
+    out << "\n";
+  });
+  if (!found)
+  {
+    out << "The word " << word << " doesn't exist in " << dictName << "\n";
   }
-  out << "\n";
 }
 
 void smirnov::removeCommand(Dicts & dicts, std::istream & in, std::ostream & out)
@@ -160,7 +172,9 @@ void smirnov::saveCommand(Dicts & dicts, std::istream & in, std::ostream & out)
     out << "<INVALID COMMAND>\n";
     return;
   }
-  if (fileName.size() < 4 || fileName.substr(fileName.size() - 4) != ".txt")
+  bool isText = fileName.size() >= 4 && fileName.substr(fileName.size() - 4) == ".txt";
+  bool isImage = fileName.size() >= 5 && fileName.substr(fileName.size() - 5) == ".dict";
+  if (!isText && !isImage)
   {
     out << "<INVALID COMMAND>\n";
     return;
@@ -171,6 +185,18 @@ void smirnov::saveCommand(Dicts & dicts, std::istream & in, std::ostream & out)
     out << "The dictionary with name " << dictName << " doesn't exist.\n";
     return;
   }
+  if (isImage)
+  {
+    try
+    {
+      DictImage::save(fileName, dictName, dictIt->second);
+    }
+    catch (const std::exception &)
+    {
+      out << "<INVALID COMMAND>\n";
+    }
+    return;
+  }
   std::ofstream file(fileName);
   if (!file)
   {
@@ -179,16 +205,7 @@ void smirnov::saveCommand(Dicts & dicts, std::istream & in, std::ostream & out)
   }
   file << dictName << "\n";
   const Dict & dict = dictIt->second;
-  for (auto it = dict.cbegin(); it != dict.cend(); ++it)
-  {
-    file << it->first << " -";
-    const Array & translations = it->second;
-    for (std::size_t i = 0; i < translations.size(); ++i)
-    {
-      file << " " << translations[i];
-    }
-    file << "\n";
-  }
+  dict.traverseSorted("", EntryPrinter{file});
 }
 
 void smirnov::mergeCommand(Dicts & dicts, std::istream & in, std::ostream & out)
@@ -496,21 +513,13 @@ void smirnov::uniqueCommand(Dicts & dicts, std::istream & in, std::ostream & out
   const Dict & dict1 = it1->second;
   const Dict & dict2 = it2->second;
   Dict result;
-  for (auto wit = dict1.cbegin(); wit != dict1.cend(); ++wit)
-  {
-    if (dict2.find(wit->first) == dict2.cend())
-    {
-      result.insert(wit->first, wit->second);
-    }
-  }
-  for (auto wit = dict2.cbegin(); wit != dict2.cend(); ++wit)
+  auto addUnique = [&](const std::string & word, bool fromFirst)
   {
-    if (dict1.find(wit->first) == dict1.cend())
-    {
-      result.insert(wit->first, wit->second);
-    }
-  }
-  dicts.insert(newName, result);
+    const Dict & source = fromFirst ? dict1 : dict2;
+    result.insert(word, source.find(word)->second);
+  };
+  KeyIndex::traverseDifference(dict1.keys(), dict2.keys(), addUnique);
+  dicts[newName] = std::move(result);
   out << "Dictionary " << newName << " is successfully created\n";
 }
 
@@ -541,23 +550,26 @@ void smirnov::prefixCommand(Dicts & dicts, std::istream & in, std::ostream & out
     return;
   }
   Dict result;
-  for (auto wit = dict.cbegin(); wit != dict.cend(); ++wit)
+  dict.traverseSorted(prefix, [&result](const std::pair< std::string, Array > & entry)
   {
-    if (wit->first.compare(0, prefix.size(), prefix) == 0)
-    {
-      result.insert(wit->first, wit->second);
-    }
-  }
+    result.insert(entry.first, entry.second);
+  });
   if (result.empty())
   {
     out << "There aren't any words in " << dictName << " with prefix " << prefix << ".\n";
     return;
   }
-  dicts.insert(newName, result);
+  dicts[newName] = std::move(result);
 }
 
 void smirnov::importDictfromFile(Dicts & dicts, const std::string & filename)
 {
+  if (DictImage::isImage(filename))
+  {
+    std::shared_ptr< const DictImage > image = DictImage::open(filename);
+    dicts.insert(image->name(), Dict(image));
+    return;
+  }
   std::ifstream file(filename);
   if (!file)
   {
@@ -627,7 +639,7 @@ void smirnov::helpCommand(std::ostream & out)
   out << "3) translate <dict> <key> - Output all translations for a word\n";
   out << "4) remove <dict> <key> - Delete a word from the dictionary\n";
   out << "5) print <dict> - Show all words and translations from a dictionary\n";
-  out << "6) save <dict> <filename> - Save dictionary to file\n";
+  out << "6) save <dict> <filename> - Save dictionary to a .txt file or a binary .dict image\n";
   out << "7) merge <newdict> <dict1> <dict2> - Merge two dictionaries into a new one\n";
   out << "8) delete <dict> - Delete a dictionary\n";
   out << "9) edit <dict> <key> <translation> - Replace all translations for a word\n";
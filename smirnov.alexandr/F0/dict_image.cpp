@@ -0,0 +1,285 @@
+#include "dict_image.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "dictionary.hpp"
+
+namespace
+{
+  const char imageMagic[] = "SMRDICT1";
+  const std::size_t magicSize = 8;
+
+  void throwInvalidImage()
+  {
+    throw std::runtime_error("Invalid dictionary image\n");
+  }
+}
+
+smirnov::DictImage::DictImage():
+  data_(nullptr),
+  length_(0),
+  name_(),
+  words_(nullptr),
+  translations_(nullptr),
+  buckets_(nullptr),
+  pool_(nullptr),
+  wordCount_(0),
+  translationCount_(0),
+  bucketCount_(0),
+  poolSize_(0)
+{}
+
+smirnov::DictImage::~DictImage()
+{
+  if (data_ != nullptr)
+  {
+    ::munmap(const_cast< char * >(data_), length_);
+  }
+}
+
+bool smirnov::DictImage::isImage(const std::string & fileName)
+{
+  std::ifstream file(fileName, std::ios::binary);
+  char magic[magicSize] = {};
+  file.read(magic, magicSize);
+  return file && std::memcmp(magic, imageMagic, magicSize) == 0;
+}
+
+std::shared_ptr< const smirnov::DictImage > smirnov::DictImage::open(const std::string & fileName)
+{
+  int fd = ::open(fileName.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    throw std::runtime_error("Cannot open file\n");
+  }
+  struct stat info;
+  if (::fstat(fd, std::addressof(info)) != 0 || static_cast< std::size_t >(info.st_size) < sizeof(Header))
+  {
+    ::close(fd);
+    throwInvalidImage();
+  }
+  std::size_t length = info.st_size;
+  void * mapped = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED)
+  {
+    throw std::runtime_error("Cannot open file\n");
+  }
+  std::shared_ptr< DictImage > image(new DictImage());
+  image->data_ = static_cast< const char * >(mapped);
+  image->length_ = length;
+
+  Header header;
+  std::memcpy(std::addressof(header), image->data_, sizeof(Header));
+  bool valid = std::memcmp(header.magic, imageMagic, magicSize) == 0;
+  valid = valid && header.wordCount <= length / sizeof(WordRecord);
+  valid = valid && header.translationCount <= length / sizeof(TranslationRecord);
+  valid = valid && header.bucketCount <= length / sizeof(std::uint32_t);
+  valid = valid && header.bucketCount > header.wordCount;
+  valid = valid && (header.bucketCount & (header.bucketCount - 1)) == 0;
+  if (!valid)
+  {
+    throwInvalidImage();
+  }
+  std::size_t wordsOffset = sizeof(Header);
+  std::size_t translationsOffset = wordsOffset + header.wordCount * sizeof(WordRecord);
+  std::size_t bucketsOffset = translationsOffset + header.translationCount * sizeof(TranslationRecord);
+  std::size_t poolOffset = bucketsOffset + header.bucketCount * sizeof(std::uint32_t);
+  if (poolOffset > length || header.poolSize != length - poolOffset || header.nameLength > header.poolSize)
+  {
+    throwInvalidImage();
+  }
+  image->words_ = reinterpret_cast< const WordRecord * >(image->data_ + wordsOffset);
+  image->translations_ = reinterpret_cast< const TranslationRecord * >(image->data_ + translationsOffset);
+  image->buckets_ = reinterpret_cast< const std::uint32_t * >(image->data_ + bucketsOffset);
+  image->pool_ = image->data_ + poolOffset;
+  image->wordCount_ = header.wordCount;
+  image->translationCount_ = header.translationCount;
+  image->bucketCount_ = header.bucketCount;
+  image->poolSize_ = header.poolSize;
+  image->name_.assign(image->pool_, header.nameLength);
+  return image;
+}
+
+void smirnov::DictImage::save(const std::string & fileName, const std::string & name, const Dict & dict)
+{
+  std::vector< WordRecord > words;
+  std::vector< TranslationRecord > translations;
+  std::string pool = name;
+  words.reserve(dict.size());
+  dict.traverseSorted("", [&words, &translations, &pool](const Entry & entry)
+  {
+    const Array & values = entry.second;
+    WordRecord word{pool.size(), static_cast< std::uint32_t >(entry.first.size()),
+        static_cast< std::uint32_t >(values.size()), translations.size()};
+    pool += entry.first;
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+      translations.push_back(TranslationRecord{pool.size(), values[i].size()});
+      pool += values[i];
+    }
+    words.push_back(word);
+  });
+  if (words.size() >= std::numeric_limits< std::uint32_t >::max())
+  {
+    throw std::length_error("Dictionary is too large\n");
+  }
+
+  std::size_t bucketCount = 1;
+  while (bucketCount <= words.size() * 2)
+  {
+    bucketCount *= 2;
+  }
+  std::vector< std::uint32_t > buckets(bucketCount, 0);
+  for (std::size_t i = 0; i < words.size(); ++i)
+  {
+    std::size_t slot = hash(pool.data() + words[i].keyOffset, words[i].keyLength) & (bucketCount - 1);
+    while (buckets[slot] != 0)
+    {
+      slot = (slot + 1) & (bucketCount - 1);
+    }
+    buckets[slot] = static_cast< std::uint32_t >(i + 1);
+  }
+
+  Header header{{}, name.size(), words.size(), translations.size(), bucketCount, pool.size()};
+  std::memcpy(header.magic, imageMagic, magicSize);
+  std::string tmpName = fileName + ".tmp";
+  std::ofstream file(tmpName, std::ios::binary);
+  file.write(reinterpret_cast< const char * >(std::addressof(header)), sizeof(Header));
+  file.write(reinterpret_cast< const char * >(words.data()), words.size() * sizeof(WordRecord));
+  file.write(reinterpret_cast< const char * >(translations.data()), translations.size() * sizeof(TranslationRecord));
+  file.write(reinterpret_cast< const char * >(buckets.data()), buckets.size() * sizeof(std::uint32_t));
+  file.write(pool.data(), pool.size());
+  file.close();
+  if (!file || std::rename(tmpName.c_str(), fileName.c_str()) != 0)
+  {
+    std::remove(tmpName.c_str());
+    throw std::runtime_error("Cannot write file\n");
+  }
+}
+
+const std::string & smirnov::DictImage::name() const noexcept
+{
+  return name_;
+}
+
+std::size_t smirnov::DictImage::size() const noexcept
+{
+  return wordCount_;
+}
+
+std::size_t smirnov::DictImage::find(const std::string & key) const
+{
+  std::size_t mask = bucketCount_ - 1;
+  std::size_t slot = hash(key.data(), key.size()) & mask;
+  for (std::size_t attempt = 0; attempt < bucketCount_; ++attempt)
+  {
+    std::uint32_t value = buckets_[slot];
+    if (value == 0)
+    {
+      break;
+    }
+    if (value > wordCount_)
+    {
+      throwInvalidImage();
+    }
+    const WordRecord & word = words_[value - 1];
+    if (word.keyLength == key.size() && std::memcmp(poolAt(word.keyOffset, word.keyLength), key.data(), key.size()) == 0)
+    {
+      return value - 1;
+    }
+    slot = (slot + 1) & mask;
+  }
+  return wordCount_;
+}
+
+std::size_t smirnov::DictImage::lowerBound(const std::string & prefix) const
+{
+  std::size_t first = 0;
+  std::size_t last = wordCount_;
+  while (first < last)
+  {
+    std::size_t middle = first + (last - first) / 2;
+    if (compareKey(middle, prefix) < 0)
+    {
+      first = middle + 1;
+    }
+    else
+    {
+      last = middle;
+    }
+  }
+  return first;
+}
+
+bool smirnov::DictImage::hasPrefix(std::size_t index, const std::string & prefix) const
+{
+  const WordRecord & word = words_[index];
+  if (word.keyLength < prefix.size())
+  {
+    return false;
+  }
+  const char * key = poolAt(word.keyOffset, word.keyLength);
+  return std::char_traits< char >::compare(key, prefix.data(), prefix.size()) == 0;
+}
+
+void smirnov::DictImage::read(std::size_t index, Entry & entry) const
+{
+  const WordRecord & word = words_[index];
+  if (word.firstTranslation > translationCount_ || word.translationCount > translationCount_ - word.firstTranslation)
+  {
+    throwInvalidImage();
+  }
+  entry.first.assign(poolAt(word.keyOffset, word.keyLength), word.keyLength);
+  entry.second.clear();
+  for (std::size_t i = 0; i < word.translationCount; ++i)
+  {
+    const TranslationRecord & translation = translations_[word.firstTranslation + i];
+    entry.second.push_back(std::string(poolAt(translation.offset, translation.length), translation.length));
+  }
+}
+
+std::uint64_t smirnov::DictImage::hash(const char * data, std::size_t length) noexcept
+{
+  std::uint64_t result = 14695981039346656037ull;
+  for (std::size_t i = 0; i < length; ++i)
+  {
+    result ^= static_cast< unsigned char >(data[i]);
+    result *= 1099511628211ull;
+  }
+  return result;
+}
+
+const char * smirnov::DictImage::poolAt(std::uint64_t offset, std::uint64_t length) const
+{
+  if (offset > poolSize_ || length > poolSize_ - offset)
+  {
+    throwInvalidImage();
+  }
+  return pool_ + offset;
+}
+
+int smirnov::DictImage::compareKey(std::size_t index, const std::string & key) const
+{
+  const WordRecord & word = words_[index];
+  const char * stored = poolAt(word.keyOffset, word.keyLength);
+  std::size_t common = std::min< std::size_t >(word.keyLength, key.size());
+  int result = std::char_traits< char >::compare(stored, key.data(), common);
+  if (result != 0)
+  {
+    return result;
+  }
+  if (word.keyLength == key.size())
+  {
+    return 0;
+  }
+  return word.keyLength < key.size() ? -1 : 1;
+}
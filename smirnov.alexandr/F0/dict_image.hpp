@@ -0,0 +1,74 @@
+#ifndef DICT_IMAGE_HPP
+#define DICT_IMAGE_HPP
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include "array.hpp"
+
+namespace smirnov
+{
+  class Dict;
+
+  class DictImage
+  {
+  public:
+    using Entry = std::pair< std::string, Array >;
+
+    DictImage(const DictImage &) = delete;
+    DictImage & operator=(const DictImage &) = delete;
+    ~DictImage();
+
+    static bool isImage(const std::string & fileName);
+    static std::shared_ptr< const DictImage > open(const std::string & fileName);
+    static void save(const std::string & fileName, const std::string & name, const Dict & dict);
+
+    const std::string & name() const noexcept;
+    std::size_t size() const noexcept;
+    std::size_t find(const std::string & key) const;
+    std::size_t lowerBound(const std::string & prefix) const;
+    bool hasPrefix(std::size_t index, const std::string & prefix) const;
+    void read(std::size_t index, Entry & entry) const;
+  private:
+    struct Header
+    {
+      char magic[8];
+      std::uint64_t nameLength;
+      std::uint64_t wordCount;
+      std::uint64_t translationCount;
+      std::uint64_t bucketCount;
+      std::uint64_t poolSize;
+    };
+    struct WordRecord
+    {
+      std::uint64_t keyOffset;
+      std::uint32_t keyLength;
+      std::uint32_t translationCount;
+      std::uint64_t firstTranslation;
+    };
+    struct TranslationRecord
+    {
+      std::uint64_t offset;
+      std::uint64_t length;
+    };
+
+    const char * data_;
+    std::size_t length_;
+    std::string name_;
+    const WordRecord * words_;
+    const TranslationRecord * translations_;
+    const std::uint32_t * buckets_;
+    const char * pool_;
+    std::size_t wordCount_;
+    std::size_t translationCount_;
+    std::size_t bucketCount_;
+    std::size_t poolSize_;
+
+    DictImage();
+    static std::uint64_t hash(const char * data, std::size_t length) noexcept;
+    const char * poolAt(std::uint64_t offset, std::uint64_t length) const;
+    int compareKey(std::size_t index, const std::string & key) const;
+  };
+}
+#endif
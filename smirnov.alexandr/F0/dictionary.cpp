@@ -0,0 +1,126 @@
+#include "dictionary.hpp"
+
+smirnov::Dict::Dict():
+  words_(),
+  index_(),
+  indexed_(false),
+  image_()
+{}
+
+smirnov::Dict::Dict(std::shared_ptr< const DictImage > image):
+  words_(),
+  index_(),
+  indexed_(false),
+  image_(image)
+{}
+
+smirnov::Dict::iterator smirnov::Dict::begin()
+{
+  materialize();
+  return words_.begin();
+}
+
+smirnov::Dict::iterator smirnov::Dict::end()
+{
+  materialize();
+  return words_.end();
+}
+
+smirnov::Dict::iterator smirnov::Dict::find(const std::string & key)
+{
+  materialize();
+  return words_.find(key);
+}
+
+smirnov::Dict::const_iterator smirnov::Dict::cbegin() const
+{
+  materialize();
+  const Table & words = words_;
+  return words.cbegin();
+}
+
+smirnov::Dict::const_iterator smirnov::Dict::cend() const
+{
+  materialize();
+  const Table & words = words_;
+  return words.cend();
+}
+
+smirnov::Dict::const_iterator smirnov::Dict::find(const std::string & key) const
+{
+  materialize();
+  const Table & words = words_;
+  return words.find(key);
+}
+
+std::pair< smirnov::Dict::iterator, bool > smirnov::Dict::insert(const std::string & key, const Array & value)
+{
+  materialize();
+  auto result = words_.insert(key, value);
+  if (indexed_ && result.second)
+  {
+    try
+    {
+      index_.insert(key);
+    }
+    catch (...)
+    {
+      index_.clear();
+      indexed_ = false;
+    }
+  }
+  return result;
+}
+
+smirnov::Dict::iterator smirnov::Dict::erase(iterator pos)
+{
+  materialize();
+  if (indexed_)
+  {
+    index_.erase(pos->first);
+  }
+  return words_.erase(pos);
+}
+
+std::size_t smirnov::Dict::size() const noexcept
+{
+  return image_ ? image_->size() : words_.size();
+}
+
+bool smirnov::Dict::empty() const noexcept
+{
+  return size() == 0;
+}
+
+const smirnov::KeyIndex & smirnov::Dict::keys() const
+{
+  materialize();
+  if (!indexed_)
+  {
+    KeyIndex index;
+    for (auto it = words_.cbegin(); it != words_.cend(); ++it)
+    {
+      index.insert(it->first);
+    }
+    index_.swap(index);
+    indexed_ = true;
+  }
+  return index_;
+}
+
+void smirnov::Dict::materialize() const
+{
+  if (!image_)
+  {
+    return;
+  }
+  Table words;
+  DictImage::Entry entry;
+  for (std::size_t i = 0; i < image_->size(); ++i)
+  {
+    image_->read(i, entry);
+    words.insert(entry.first, entry.second);
+  }
+  words_.swap(words);
+  image_.reset();
+}
@@ -1,8 +1,98 @@
-#include "array.hpp"
+#ifndef DICTIONARY_HPP
+#define DICTIONARY_HPP
+#include <memory>
+#include <string>
+#include <utility>
 #include <hash_table/hashTable.hpp>
+#include "array.hpp"
+#include "dict_image.hpp"
+#include "key_index.hpp"
 
 namespace smirnov
 {
-  using Dict = HashTable< std::string, Array >;
+  class Dict
+  {
+  public:
+    using Table = HashTable< std::string, Array >;
+    using iterator = Table::iterator;
+    using const_iterator = Table::const_iterator;
+
+    Dict();
+    explicit Dict(std::shared_ptr< const DictImage > image);
+
+    iterator begin();
+    iterator end();
+    iterator find(const std::string & key);
+    const_iterator cbegin() const;
+    const_iterator cend() const;
+    const_iterator find(const std::string & key) const;
+
+    std::pair< iterator, bool > insert(const std::string & key, const Array & value);
+    iterator erase(iterator pos);
+
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+
+    const KeyIndex & keys() const;
+    template< class F >
+    bool visit(const std::string & key, F f) const;
+    template< class F >
+    F traverseSorted(const std::string & prefix, F f) const;
+  private:
+    mutable Table words_;
+    mutable KeyIndex index_;
+    mutable bool indexed_;
+    mutable std::shared_ptr< const DictImage > image_;
+
+    void materialize() const;
+  };
+
+  template< class F >
+  bool Dict::visit(const std::string & key, F f) const
+  {
+    if (image_)
+    {
+      std::size_t index = image_->find(key);
+      if (index == image_->size())
+      {
+        return false;
+      }
+      DictImage::Entry entry;
+      image_->read(index, entry);
+      f(static_cast< const DictImage::Entry & >(entry));
+      return true;
+    }
+    const Table & words = words_;
+    auto it = words.find(key);
+    if (it == words.cend())
+    {
+      return false;
+    }
+    f(*it);
+    return true;
+  }
+
+  template< class F >
+  F Dict::traverseSorted(const std::string & prefix, F f) const
+  {
+    if (image_)
+    {
+      DictImage::Entry entry;
+      for (std::size_t i = image_->lowerBound(prefix); i < image_->size() && image_->hasPrefix(i, prefix); ++i)
+      {
+        image_->read(i, entry);
+        f(static_cast< const DictImage::Entry & >(entry));
+      }
+      return f;
+    }
+    const Table & words = words_;
+    keys().traverse(prefix, [&f, &words](const std::string & key)
+    {
+      f(*words.find(key));
+    });
+    return f;
+  }
+
   using Dicts = HashTable< std::string, Dict >;
 }
+#endif
@@ -0,0 +1,197 @@
+#include "key_index.hpp"
+#include <memory>
+#include <utility>
+
+smirnov::KeyIndex::KeyIndex():
+  root_{'\0', false, nullptr, nullptr},
+  size_(0)
+{}
+
+smirnov::KeyIndex::KeyIndex(const KeyIndex & other):
+  root_{'\0', other.root_.terminal, copyNodes(other.root_.child), nullptr},
+  size_(other.size_)
+{}
+
+smirnov::KeyIndex::KeyIndex(KeyIndex && other) noexcept:
+  root_(other.root_),
+  size_(other.size_)
+{
+  other.root_.terminal = false;
+  other.root_.child = nullptr;
+  other.size_ = 0;
+}
+
+smirnov::KeyIndex & smirnov::KeyIndex::operator=(const KeyIndex & other)
+{
+  if (this != std::addressof(other))
+  {
+    KeyIndex temp(other);
+    swap(temp);
+  }
+  return *this;
+}
+
+smirnov::KeyIndex & smirnov::KeyIndex::operator=(KeyIndex && other) noexcept
+{
+  if (this != std::addressof(other))
+  {
+    KeyIndex temp(std::move(other));
+    swap(temp);
+  }
+  return *this;
+}
+
+smirnov::KeyIndex::~KeyIndex()
+{
+  clearNodes(root_.child);
+}
+
+void smirnov::KeyIndex::insert(const std::string & key)
+{
+  Node * node = std::addressof(root_);
+  for (std::size_t i = 0; i < key.size(); ++i)
+  {
+    Node ** link = findLink(std::addressof(node->child), key[i]);
+    if (!*link || (*link)->symbol != key[i])
+    {
+      *link = new Node{key[i], false, nullptr, *link};
+    }
+    node = *link;
+  }
+  if (!node->terminal)
+  {
+    node->terminal = true;
+    ++size_;
+  }
+}
+
+void smirnov::KeyIndex::erase(const std::string & key)
+{
+  if (key.empty())
+  {
+    if (root_.terminal)
+    {
+      root_.terminal = false;
+      --size_;
+    }
+    return;
+  }
+  if (eraseKey(std::addressof(root_.child), key, 0))
+  {
+    --size_;
+  }
+}
+
+void smirnov::KeyIndex::clear() noexcept
+{
+  clearNodes(root_.child);
+  root_.child = nullptr;
+  root_.terminal = false;
+  size_ = 0;
+}
+
+void smirnov::KeyIndex::swap(KeyIndex & other) noexcept
+{
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+}
+
+std::size_t smirnov::KeyIndex::size() const noexcept
+{
+  return size_;
+}
+
+bool smirnov::KeyIndex::empty() const noexcept
+{
+  return size_ == 0;
+}
+
+bool smirnov::KeyIndex::less(char lhs, char rhs) noexcept
+{
+  return std::char_traits< char >::lt(lhs, rhs);
+}
+
+smirnov::KeyIndex::Node ** smirnov::KeyIndex::findLink(Node ** link, char symbol) noexcept
+{
+  while (*link && less((*link)->symbol, symbol))
+  {
+    link = std::addressof((*link)->sibling);
+  }
+  return link;
+}
+
+smirnov::KeyIndex::Node * smirnov::KeyIndex::copyNodes(const Node * node)
+{
+  Node * head = nullptr;
+  Node ** tail = std::addressof(head);
+  try
+  {
+    for (; node; node = node->sibling)
+    {
+      *tail = new Node{node->symbol, node->terminal, nullptr, nullptr};
+      (*tail)->child = copyNodes(node->child);
+      tail = std::addressof((*tail)->sibling);
+    }
+  }
+  catch (...)
+  {
+    clearNodes(head);
+    throw;
+  }
+  return head;
+}
+
+void smirnov::KeyIndex::clearNodes(Node * node) noexcept
+{
+  while (node)
+  {
+    Node * next = node->sibling;
+    clearNodes(node->child);
+    delete node;
+    node = next;
+  }
+}
+
+bool smirnov::KeyIndex::eraseKey(Node ** link, const std::string & key, std::size_t pos) noexcept
+{
+  link = findLink(link, key[pos]);
+  Node * node = *link;
+  if (!node || node->symbol != key[pos])
+  {
+    return false;
+  }
+  bool erased = false;
+  if (pos + 1 == key.size())
+  {
+    erased = node->terminal;
+    node->terminal = false;
+  }
+  else
+  {
+    erased = eraseKey(std::addressof(node->child), key, pos + 1);
+  }
+  if (!node->terminal && !node->child)
+  {
+    *link = node->sibling;
+    delete node;
+  }
+  return erased;
+}
+
+const smirnov::KeyIndex::Node * smirnov::KeyIndex::findPrefix(const std::string & prefix) const noexcept
+{
+  const Node * node = std::addressof(root_);
+  for (std::size_t i = 0; node && i < prefix.size(); ++i)
+  {
+    node = node->child;
+    while (node && less(node->symbol, prefix[i]))
+    {
+      node = node->sibling;
+    }
+    if (node && node->symbol != prefix[i])
+    {
+      node = nullptr;
+    }
+  }
+  return node;
+}
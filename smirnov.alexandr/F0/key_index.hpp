@@ -0,0 +1,141 @@
+#ifndef KEY_INDEX_HPP
+#define KEY_INDEX_HPP
+#include <cstddef>
+#include <string>
+
+namespace smirnov
+{
+  class KeyIndex
+  {
+  public:
+    KeyIndex();
+    KeyIndex(const KeyIndex & other);
+    KeyIndex(KeyIndex && other) noexcept;
+    KeyIndex & operator=(const KeyIndex & other);
+    KeyIndex & operator=(KeyIndex && other) noexcept;
+    ~KeyIndex();
+    void insert(const std::string & key);
+    void erase(const std::string & key);
+    void clear() noexcept;
+    void swap(KeyIndex & other) noexcept;
+    std::size_t size() const noexcept;
+    bool empty() const noexcept;
+    template< class F >
+    F traverse(const std::string & prefix, F f) const;
+    template< class F >
+    static F traverseDifference(const KeyIndex & lhs, const KeyIndex & rhs, F f);
+  private:
+    struct Node
+    {
+      char symbol;
+      bool terminal;
+      Node * child;
+      Node * sibling;
+    };
+    Node root_;
+    std::size_t size_;
+    static bool less(char lhs, char rhs) noexcept;
+    static Node ** findLink(Node ** link, char symbol) noexcept;
+    static Node * copyNodes(const Node * node);
+    static void clearNodes(Node * node) noexcept;
+    static bool eraseKey(Node ** link, const std::string & key, std::size_t pos) noexcept;
+    const Node * findPrefix(const std::string & prefix) const noexcept;
+    template< class F >
+    static void traverseNodes(const Node * node, std::string & key, F & f);
+    template< class F >
+    static void traverseDifferenceNodes(const Node * lhs, const Node * rhs, std::string & key, F & f);
+  };
+
+  template< class F >
+  F KeyIndex::traverse(const std::string & prefix, F f) const
+  {
+    const Node * node = findPrefix(prefix);
+    if (!node)
+    {
+      return f;
+    }
+    std::string key = prefix;
+    if (node->terminal)
+    {
+      f(static_cast< const std::string & >(key));
+    }
+    traverseNodes(node->child, key, f);
+    return f;
+  }
+
+  template< class F >
+  F KeyIndex::traverseDifference(const KeyIndex & lhs, const KeyIndex & rhs, F f)
+  {
+    std::string key;
+    if (lhs.root_.terminal != rhs.root_.terminal)
+    {
+      f(static_cast< const std::string & >(key), lhs.root_.terminal);
+    }
+    traverseDifferenceNodes(lhs.root_.child, rhs.root_.child, key, f);
+    return f;
+  }
+
+  template< class F >
+  void KeyIndex::traverseNodes(const Node * node, std::string & key, F & f)
+  {
+    for (; node; node = node->sibling)
+    {
+      key.push_back(node->symbol);
+      if (node->terminal)
+      {
+        f(static_cast< const std::string & >(key));
+      }
+      traverseNodes(node->child, key, f);
+      key.pop_back();
+    }
+  }
+
+  template< class F >
+  void KeyIndex::traverseDifferenceNodes(const Node * lhs, const Node * rhs, std::string & key, F & f)
+  {
+    while (lhs || rhs)
+    {
+      if (!rhs || (lhs && less(lhs->symbol, rhs->symbol)))
+      {
+        key.push_back(lhs->symbol);
+        if (lhs->terminal)
+        {
+          f(static_cast< const std::string & >(key), true);
+        }
+        auto fromLhs = [&f](const std::string & word)
+        {
+          f(word, true);
+        };
+        traverseNodes(lhs->child, key, fromLhs);
+        lhs = lhs->sibling;
+      }
+      else if (!lhs || less(rhs->symbol, lhs->symbol))
+      {
+        key.push_back(rhs->symbol);
+        if (rhs->terminal)
+        {
+          f(static_cast< const std::string & >(key), false);
+        }
+        auto fromRhs = [&f](const std::string & word)
+        {
+          f(word, false);
+        };
+        traverseNodes(rhs->child, key, fromRhs);
+        rhs = rhs->sibling;
+      }
+      else
+      {
+        key.push_back(lhs->symbol);
+        if (lhs->terminal != rhs->terminal)
+        {
+          f(static_cast< const std::string & >(key), lhs->terminal);
+        }
+        traverseDifferenceNodes(lhs->child, rhs->child, key, f);
+        lhs = lhs->sibling;
+        rhs = rhs->sibling;
+      }
+      key.pop_back();
+    }
+  }
+}
+#endif
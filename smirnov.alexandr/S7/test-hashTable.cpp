@@ -1,6 +1,17 @@
 #include <boost/test/unit_test.hpp>
 #include <hash_table/hashTable.hpp>
 
+namespace
+{
+  struct ConstantHash
+  {
+    size_t operator()(int) const
+    {
+      return 0;
+    }
+  };
+}
+
 BOOST_AUTO_TEST_CASE(test_insert_and_find)
 {
   smirnov::HashTable< int, std::string > table;
@@ -123,3 +134,20 @@ BOOST_AUTO_TEST_CASE(test_rehash)
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(test_colliding_keys)
+{
+  smirnov::HashTable< int, int, ConstantHash > table;
+  for (int i = 0; i < 100; ++i)
+  {
+    table.insert(i, i * 2);
+  }
+  BOOST_TEST(table.size() == 100);
+  size_t found = 0;
+  for (int i = 0; i < 100; ++i)
+  {
+    auto it = table.find(i);
+    found += !(it == table.end()) && it->second == i * 2;
+  }
+  BOOST_TEST(found == 100);
+}
@@ -373,7 +373,7 @@ namespace smirnov
   template< class Key, class Value, class Hash, class Equal >
   size_t HashTable< Key, Value, Hash, Equal >::probe(size_t hash_value, size_t attempt) const noexcept
   {
-    return (hash_value + attempt * attempt) % buckets_.size();
+    return (hash_value + attempt * (attempt + 1) / 2) % buckets_.size();
   }
 
   template< class Key, class Value, class Hash, class Equal >
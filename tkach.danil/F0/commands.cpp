@@ -665,7 +665,6 @@ void tkach::copyTranslations(std::istream& in, AvlTree< std::string, AvlTree< st
 
 void tkach::import(std::istream& in, AvlTree< std::string, AvlTree< std::string, List< std::string > > >& avltree)
 {
-  tree_of_dict temp(avltree);
   std::string file_name = "";
   int count_of_dict = 0;
   if (!(in >> file_name))
@@ -688,58 +687,71 @@ void tkach::import(std::istream& in, AvlTree< std::string, AvlTree< std::string,
     {
       throw std::logic_error("<INVALID ARGUMENTS>");
     }
-    auto it = temp.find(main_name_dict[i]);
-    if (it == temp.end())
+    auto it = avltree.find(main_name_dict[i]);
+    if (it == avltree.end())
     {
       throw std::logic_error("<INVALID IMPORT>");
     }
   }
-  std::string name_of_dict = "";
-  while (in2 >> name_of_dict)
+  HashDynArray< tree_of_words > imported(count_of_dict);
+  avltree.snapshot();
+  try
   {
-    if (name_of_dict.empty())
-    {
-      continue;
-    }
-    tree_of_words temp_dict;
-    std::string eng_word;
-    while (in2 >> eng_word)
+    std::string name_of_dict = "";
+    while (in2 >> name_of_dict)
     {
-      List< std::string > translations;
-      std::string translation;
-      while (in2 >> translation)
+      if (name_of_dict.empty())
+      {
+        continue;
+      }
+      tree_of_words temp_dict;
+      std::string eng_word;
+      while (in2 >> eng_word)
       {
-        translations.pushBack(translation);
+        List< std::string > translations;
+        std::string translation;
+        while (in2 >> translation)
+        {
+          translations.pushBack(translation);
+          if (in2.peek() == '\n')
+          {
+            in2.get();
+            break;
+          }
+        }
+        temp_dict[eng_word] = mergeTranslations(translations, temp_dict[eng_word]);
         if (in2.peek() == '\n')
         {
           in2.get();
           break;
         }
       }
-      temp_dict[eng_word] = mergeTranslations(translations, temp_dict[eng_word]);
-      if (in2.peek() == '\n')
-      {
-        in2.get();
-        break;
-      }
+      avltree.insertOrAssign(name_of_dict, mergeDicts({&temp_dict, &avltree[name_of_dict]}));
+    }
+    if (!in2.eof())
+    {
+      throw std::logic_error("<INVALID IMPORT>");
+    }
+    for (size_t i = 0; i < static_cast< size_t >(count_of_dict); ++i)
+    {
+      imported[i] = std::move(avltree.find(main_name_dict[i])->second);
     }
-    temp[name_of_dict] = mergeDicts({&temp_dict, &temp[name_of_dict]});
   }
-  if (!in2.eof())
+  catch (...)
   {
-    throw std::logic_error("<INVALID IMPORT>");
+    avltree.rollback();
+    throw;
   }
-  if (count_of_dict != 0)
+  if (count_of_dict == 0)
   {
-    for (size_t i = 0; i < static_cast< size_t >(count_of_dict); ++i)
-    {
-      auto it = temp.find(main_name_dict[i]);
-      avltree[main_name_dict[i]] = temp[main_name_dict[i]];
-    }
+    avltree.commit();
+    return;
   }
-  else
+  avltree.rollback();
+  // a repeated name is moved out only once, so its first occurrence has to be assigned last
+  for (size_t i = static_cast< size_t >(count_of_dict); i > 0; --i)
   {
-    avltree = std::move(temp);
+    avltree[main_name_dict[i - 1]] = std::move(imported[i - 1]);
   }
 }
 
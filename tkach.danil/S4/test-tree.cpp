@@ -401,3 +401,63 @@ BOOST_AUTO_TEST_CASE(tree_cend_test)
   }
   BOOST_TEST(i == 6);
 }
+
+BOOST_AUTO_TEST_CASE(tree_snapshot_rollback_test)
+{
+  AvlTree< size_t, std::string > tree;
+  for (size_t i = 0; i < 10; ++i)
+  {
+    tree.insert(std::make_pair(i, std::to_string(i)));
+  }
+  tree.snapshot();
+  BOOST_TEST(tree.hasSnapshot());
+  for (size_t i = 10; i < 20; ++i)
+  {
+    tree.insert(std::make_pair(i, std::to_string(i)));
+  }
+  tree.erase(3);
+  tree.erase(7);
+  tree.insertOrAssign(5, "five");
+  BOOST_TEST(tree.size() == 18);
+  tree.rollback();
+  BOOST_TEST(!tree.hasSnapshot());
+  std::ostringstream out;
+  print(tree, out);
+  BOOST_TEST(out.str() == "0 0 1 1 2 2 3 3 4 4 5 5 6 6 7 7 8 8 9 9");
+  std::ostringstream back;
+  for (auto it = tree.find(9); it != tree.end(); --it)
+  {
+    back << it->first;
+  }
+  BOOST_TEST(back.str() == "9876543210");
+}
+
+BOOST_AUTO_TEST_CASE(tree_snapshot_commit_test)
+{
+  AvlTree< size_t, std::string > tree{std::make_pair(1, "first"), std::make_pair(2, "second"), std::make_pair(3, "third")};
+  tree.snapshot();
+  tree.erase(2);
+  tree.insertOrAssign(3, "3");
+  tree.insertOrAssign(4, "4");
+  tree.clear();
+  tree.insert(std::make_pair(5, "5"));
+  tree.commit();
+  std::ostringstream out;
+  print(tree, out);
+  BOOST_TEST(out.str() == "5 5");
+  BOOST_CHECK_THROW(tree.rollback(), std::logic_error);
+}
+
+BOOST_AUTO_TEST_CASE(tree_snapshot_copy_assign_test)
+{
+  AvlTree< size_t, std::string > tree{std::make_pair(1, "first"), std::make_pair(2, "second")};
+  AvlTree< size_t, std::string > other{std::make_pair(3, "third")};
+  tree.snapshot();
+  tree.erase(1);
+  BOOST_CHECK_THROW(tree = other, std::logic_error);
+  BOOST_TEST(tree.hasSnapshot());
+  tree.rollback();
+  std::ostringstream out;
+  print(tree, out);
+  BOOST_TEST(out.str() == "1 first 2 second");
+}
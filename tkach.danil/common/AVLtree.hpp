@@ -2,6 +2,7 @@
 #define AVLTREE_HPP
 
 #include <functional>
+#include <stdexcept>
 #include "node_tree.hpp"
 #include "c_iterator.hpp"
 #include "iterator.hpp"
@@ -29,7 +30,12 @@ namespace tkach
     Iterator< Key, Value, Cmp > insert(std::pair< Key, Value > && pair);
     template< class InputIt >
     void insert(InputIt begin, InputIt end);
+    Iterator< Key, Value, Cmp > insertOrAssign(const Key& key, Value&& value);
     void clear();
+    void snapshot();
+    void commit();
+    void rollback();
+    bool hasSnapshot() const noexcept;
     Citerator< Key, Value, Cmp > find(const Key& key) const;
     Iterator< Key, Value, Cmp > find(const Key& key);
     Value& at(const Key& key);
@@ -65,12 +71,34 @@ namespace tkach
     size_t count(const Key& k) const;
   private:
     using pair_t = std::pair< TreeNode< Key, Value >*, std::pair< TreeNode< Key, Value >*, bool > >;
+    struct NodeLinks
+    {
+      TreeNode< Key, Value >* node;
+      TreeNode< Key, Value >* parent;
+      TreeNode< Key, Value >* left;
+      TreeNode< Key, Value >* right;
+      size_t height;
+    };
+    struct Journal
+    {
+      Journal(TreeNode< Key, Value >* root, size_t size);
+      TreeNode< Key, Value >* root;
+      size_t size;
+      Stack< NodeLinks > links;
+      Stack< std::pair< TreeNode< Key, Value >*, TreeNode< Key, Value >* > > values;
+      Stack< TreeNode< Key, Value >* > created;
+      Stack< TreeNode< Key, Value >* > erased;
+    };
     TreeNode< Key, Value >* root_;
     size_t size_;
     Cmp cmp_;
+    Journal* journal_;
     template< class... Args >
     Iterator< Key, Value, Cmp > insertSingle(const Key& key, Args&&... args);
     void clearFrom(TreeNode< Key, Value >* node);
+    void saveLinks(TreeNode< Key, Value >* node);
+    void saveValue(TreeNode< Key, Value >* node);
+    void dropNode(TreeNode< Key, Value >* node);
     TreeNode< Key, Value >* findMin(TreeNode< Key, Value >* node) const;
     TreeNode< Key, Value >* findMax(TreeNode< Key, Value >* node) const;
     TreeNode< Key, Value >* rotateLeft(TreeNode< Key, Value >* const root);
@@ -88,7 +116,8 @@ namespace tkach
   AvlTree< Key, Value, Cmp >::AvlTree():
     root_(nullptr),
     size_(0),
-    cmp_(Cmp())
+    cmp_(Cmp()),
+    journal_(nullptr)
   {}
 
   template< class Key, class Value, class Cmp >
@@ -96,7 +125,8 @@ namespace tkach
   AvlTree< Key, Value, Cmp >::AvlTree(InputIt begin, InputIt end):
     root_(nullptr),
     size_(0),
-    cmp_(Cmp())
+    cmp_(Cmp()),
+    journal_(nullptr)
   {
     while (begin != end)
     {
@@ -124,6 +154,7 @@ namespace tkach
     std::swap(other.root_, root_);
     std::swap(size_, other.size_);
     std::swap(cmp_, other.cmp_);
+    std::swap(journal_, other.journal_);
   }
 
   template< class Key, class Value, class Cmp >
@@ -145,6 +176,10 @@ namespace tkach
     {
       return *this;
     }
+    if (journal_)
+    {
+      throw std::logic_error("<SNAPSHOT IS OPEN>");
+    }
     AvlTree< Key, Value, Cmp > temp(other);
     swap(temp);
     return *this;
@@ -221,6 +256,7 @@ namespace tkach
     {
       return nullptr;
     }
+    saveLinks(root);
     if (cmp_(key, root->data.first))
     {
       root->left = eraseFrom(root->left, key);
@@ -234,18 +270,20 @@ namespace tkach
       if (root->left != nullptr)
       {
         TreeNode< Key, Value >* max_tree = findMax(root->left);
+        saveValue(root);
         root->data = max_tree->data;
         root->left = eraseFrom(root->left, max_tree->data.first);
       }
       else if (root->right != nullptr)
       {
         TreeNode< Key, Value >* min_tree = findMin(root->right);
+        saveValue(root);
         root->data = min_tree->data;
         root->right = eraseFrom(root->right, min_tree->data.first);
       }
       else
       {
-        delete root;
+        dropNode(root);
         return nullptr;
       }
     }
@@ -285,6 +323,10 @@ namespace tkach
   template< class Key, class Value, class Cmp >
   AvlTree< Key, Value, Cmp >::~AvlTree()
   {
+    if (journal_)
+    {
+      commit();
+    }
     clear();
   }
 
@@ -331,10 +373,12 @@ namespace tkach
   AvlTree< Key, Value, Cmp >::AvlTree(AvlTree< Key, Value, Cmp >&& other) noexcept:
     root_(other.root_),
     size_(other.size_),
-    cmp_(other.cmp_)
+    cmp_(other.cmp_),
+    journal_(other.journal_)
   {
     other.root_ = nullptr;
     other.size_ = 0;
+    other.journal_ = nullptr;
   }
 
   template< class Key, class Value, class Cmp >
@@ -357,8 +401,15 @@ namespace tkach
       throw std::logic_error("<INVALID ROTATE>");
     }
     TreeNode< Key, Value >* rotate_tree = root->right;
+    saveLinks(root);
+    saveLinks(rotate_tree);
+    if (rotate_tree->left != nullptr)
+    {
+      saveLinks(rotate_tree->left);
+    }
     if (root->parent != nullptr)
     {
+      saveLinks(root->parent);
       if (root->parent->left == root)
       {
         root->parent->left = rotate_tree;
@@ -389,8 +440,15 @@ namespace tkach
       throw std::logic_error("<INVALID ROTATE>");
     }
     TreeNode< Key, Value >* rotate_tree = root->left;
+    saveLinks(root);
+    saveLinks(rotate_tree);
+    if (rotate_tree->right != nullptr)
+    {
+      saveLinks(rotate_tree->right);
+    }
     if (root->parent != nullptr)
     {
+      saveLinks(root->parent);
       if (root->parent->left == root)
       {
         root->parent->left = rotate_tree;
@@ -500,6 +558,19 @@ namespace tkach
     return insertSingle(pair.first, std::move(pair));
   }
 
+  template< class Key, class Value, class Cmp >
+  Iterator< Key, Value, Cmp > AvlTree< Key, Value, Cmp >::insertOrAssign(const Key& key, Value&& value)
+  {
+    Iterator< Key, Value, Cmp > it = find(key);
+    if (it == end())
+    {
+      return insert(std::make_pair(key, std::move(value)));
+    }
+    saveValue(it.node_);
+    it->second = std::move(value);
+    return it;
+  }
+
   template< class Key, class Value, class Cmp >
   template< class... Args >
   Iterator< Key, Value, Cmp > AvlTree< Key, Value, Cmp >::insertSingle(const Key& key, Args&&... args)
@@ -544,11 +615,24 @@ namespace tkach
     if (root == nullptr)
     {
       TreeNode< Key, Value >* new_node = new TreeNode< Key, Value >(std::forward< Args >(args)...);
+      if (journal_)
+      {
+        try
+        {
+          journal_->created.push(new_node);
+        }
+        catch (...)
+        {
+          delete new_node;
+          throw;
+        }
+      }
       return std::make_pair(new_node, std::make_pair(new_node, true));
     }
     else if (cmp_(key, root->data.first))
     {
       auto pair = insertCmp(root->left, key, std::forward< Args >(args)...);
+      saveLinks(root);
       root->left = pair.first;
       inserted = pair.second.first;
       if (root->left->parent == nullptr)
@@ -561,6 +645,7 @@ namespace tkach
     else if (cmp_(root->data.first, key))
     {
       auto pair = insertCmp(root->right, key, std::forward< Args >(args)...);
+      saveLinks(root);
       root->right = pair.first;
       inserted = pair.second.first;
       if (root->right->parent == nullptr)
@@ -626,11 +711,140 @@ namespace tkach
   template< class Key, class Value, class Cmp >
   void AvlTree< Key, Value, Cmp >::clear()
   {
-    clearFrom(root_);
+    if (journal_ && root_)
+    {
+      journal_->erased.push(root_);
+    }
+    else
+    {
+      clearFrom(root_);
+    }
     root_ = nullptr;
     size_ = 0;
   }
 
+  template< class Key, class Value, class Cmp >
+  AvlTree< Key, Value, Cmp >::Journal::Journal(TreeNode< Key, Value >* root, size_t size):
+    root(root),
+    size(size),
+    links(),
+    values(),
+    created(),
+    erased()
+  {}
+
+  template< class Key, class Value, class Cmp >
+  bool AvlTree< Key, Value, Cmp >::hasSnapshot() const noexcept
+  {
+    return journal_ != nullptr;
+  }
+
+  template< class Key, class Value, class Cmp >
+  void AvlTree< Key, Value, Cmp >::snapshot()
+  {
+    if (journal_)
+    {
+      throw std::logic_error("<SNAPSHOT ALREADY TAKEN>");
+    }
+    journal_ = new Journal(root_, size_);
+  }
+
+  template< class Key, class Value, class Cmp >
+  void AvlTree< Key, Value, Cmp >::commit()
+  {
+    if (!journal_)
+    {
+      throw std::logic_error("<NO SNAPSHOT>");
+    }
+    while (!journal_->values.empty())
+    {
+      delete journal_->values.top().second;
+      journal_->values.pop();
+    }
+    while (!journal_->erased.empty())
+    {
+      clearFrom(journal_->erased.top());
+      journal_->erased.pop();
+    }
+    delete journal_;
+    journal_ = nullptr;
+  }
+
+  template< class Key, class Value, class Cmp >
+  void AvlTree< Key, Value, Cmp >::rollback()
+  {
+    if (!journal_)
+    {
+      throw std::logic_error("<NO SNAPSHOT>");
+    }
+    while (!journal_->links.empty())
+    {
+      const NodeLinks& saved = journal_->links.top();
+      saved.node->parent = saved.parent;
+      saved.node->left = saved.left;
+      saved.node->right = saved.right;
+      saved.node->height = saved.height;
+      journal_->links.pop();
+    }
+    while (!journal_->values.empty())
+    {
+      auto saved = journal_->values.top();
+      saved.first->data = std::move(saved.second->data);
+      delete saved.second;
+      journal_->values.pop();
+    }
+    while (!journal_->created.empty())
+    {
+      delete journal_->created.top();
+      journal_->created.pop();
+    }
+    root_ = journal_->root;
+    size_ = journal_->size;
+    delete journal_;
+    journal_ = nullptr;
+  }
+
+  template< class Key, class Value, class Cmp >
+  void AvlTree< Key, Value, Cmp >::saveLinks(TreeNode< Key, Value >* node)
+  {
+    if (journal_)
+    {
+      journal_->links.push(NodeLinks{node, node->parent, node->left, node->right, node->height});
+    }
+  }
+
+  template< class Key, class Value, class Cmp >
+  void AvlTree< Key, Value, Cmp >::saveValue(TreeNode< Key, Value >* node)
+  {
+    if (journal_)
+    {
+      TreeNode< Key, Value >* saved = new TreeNode< Key, Value >(node->data.first, std::move(node->data.second));
+      try
+      {
+        journal_->values.push(std::make_pair(node, saved));
+      }
+      catch (...)
+      {
+        node->data.second = std::move(saved->data.second);
+        delete saved;
+        throw;
+      }
+    }
+  }
+
+  template< class Key, class Value, class Cmp >
+  void AvlTree< Key, Value, Cmp >::dropNode(TreeNode< Key, Value >* node)
+  {
+    if (journal_)
+    {
+      journal_->erased.push(node);
+    }
+    else
+    {
+      delete node;
+    }
+  }
+
   template< class Key, class Value, class Cmp >
   void AvlTree< Key, Value, Cmp >::clearFrom(TreeNode< Key, Value >* root)
   {